@@ -0,0 +1,940 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "s21_redblack_tree.h"
+
+namespace s21 {
+
+// Uninitialized room for N objects that the owning node constructs and
+// destroys one slot at a time. The void specialization is empty, so a set
+// node pays nothing for the mapped array it does not have.
+template <class T, std::size_t N>
+struct btree_slots {
+  alignas(T) unsigned char bytes[N * sizeof(T)];
+
+  T* data() noexcept { return std::launder(reinterpret_cast<T*>(bytes)); }
+  const T* data() const noexcept {
+    return std::launder(reinterpret_cast<const T*>(bytes));
+  }
+};
+
+template <std::size_t N>
+struct btree_slots<void, N> {};
+
+// Element types of a B-tree with or without mapped values. A map node keeps
+// keys and values in separate arrays, so iterators hand out a pair of
+// references rather than a reference to a stored pair.
+template <class Key, class Mapped>
+struct btree_types {
+  using value_type = std::pair<const Key, Mapped>;
+  using reference = std::pair<const Key&, Mapped&>;
+  using const_reference = std::pair<const Key&, const Mapped&>;
+  using mapped_holder = Mapped;
+};
+
+template <class Key>
+struct btree_types<Key, void> {
+  struct empty {};
+  using value_type = Key;
+  using reference = const Key&;
+  using const_reference = const Key&;
+  using mapped_holder = empty;
+};
+
+// B+ tree behind btree_map, btree_set and btree_multiset. Elements live in
+// leaves of about NodeBytes bytes that are chained for iteration; internal
+// nodes hold copies of keys as separators. A lookup touches one node per
+// level, and with tens of keys per node the tree is three to five levels
+// deep where a binary tree would be twenty-odd.
+//
+// Every separator bounds its neighbours loosely: everything in the child to
+// its left orders no later than it, everything to its right no earlier, so
+// erase can leave stale separators in place. Elements move between slots as
+// nodes split and merge, so any insertion or erasure invalidates all
+// iterators, and the container assumes that moving a Key or Mapped does not
+// throw. Allocation and key copies happen before a node is modified, so a
+// failed insert leaves the tree unchanged.
+template <class Key, class Mapped, class Compare, class Allocator, bool Multi,
+          std::size_t NodeBytes = 256>
+class BTree {
+  using Types = btree_types<Key, Mapped>;
+  static constexpr bool kIsMap = !std::is_void_v<Mapped>;
+  static constexpr std::size_t kMappedSize = [] {
+    if constexpr (kIsMap)
+      return sizeof(Mapped);
+    else
+      return std::size_t{0};
+  }();
+
+  struct Internal;
+
+  struct NodeBase {
+    Internal* parent = nullptr;
+    std::uint16_t position = 0;  // index among the parent's children
+    std::uint16_t count = 0;     // elements in a leaf, keys in an internal
+  };
+
+  static constexpr std::size_t kLeafHeader =
+      sizeof(NodeBase) + 2 * sizeof(void*);
+  static constexpr std::size_t kInnerHeader = sizeof(NodeBase) + sizeof(void*);
+
+ public:
+  static constexpr std::size_t kLeafSlots = std::clamp<std::size_t>(
+      (std::max(NodeBytes, kLeafHeader) - kLeafHeader) /
+          (sizeof(Key) + kMappedSize),
+      4, 1024);
+  static constexpr std::size_t kInnerSlots = std::clamp<std::size_t>(
+      (std::max(NodeBytes, kInnerHeader) - kInnerHeader) /
+          (sizeof(Key) + sizeof(void*)),
+      4, 1024);
+
+ private:
+  static constexpr std::size_t kMinLeaf = kLeafSlots / 2;
+  static constexpr std::size_t kMinInner = kInnerSlots / 2;
+  // Enough for any tree that fits in memory.
+  static constexpr std::size_t kMaxHeight = 64;
+
+  struct Leaf : NodeBase {
+    Leaf* prev = nullptr;
+    Leaf* next = nullptr;
+    btree_slots<Key, kLeafSlots> keys;
+    [[no_unique_address]] btree_slots<Mapped, kLeafSlots> mapped;
+  };
+
+  struct Internal : NodeBase {
+    btree_slots<Key, kInnerSlots> keys;
+    NodeBase* children[kInnerSlots + 1];
+  };
+
+  using AllocTraits = std::allocator_traits<Allocator>;
+  using LeafAlloc = typename AllocTraits::template rebind_alloc<Leaf>;
+  using LeafTraits = std::allocator_traits<LeafAlloc>;
+  using InternalAlloc = typename AllocTraits::template rebind_alloc<Internal>;
+  using InternalTraits = std::allocator_traits<InternalAlloc>;
+  using MappedHolder = typename Types::mapped_holder;
+
+  // A new element before it is moved into its slot.
+  struct Entry {
+    Key key;
+    [[no_unique_address]] MappedHolder mapped;
+  };
+
+  NodeBase* root_ = nullptr;
+  Leaf* first_ = nullptr;
+  Leaf* last_ = nullptr;
+  std::size_t height_ = 0;  // internal levels above the leaves
+  std::size_t size_ = 0;
+  [[no_unique_address]] Compare comp_;
+  [[no_unique_address]] Allocator alloc_;
+
+ public:
+  using key_type = Key;
+  using value_type = typename Types::value_type;
+  using reference = typename Types::reference;
+  using const_reference = typename Types::const_reference;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+
+  template <bool Const>
+  class Iterator {
+    using LeafPtr = std::conditional_t<Const, const Leaf*, Leaf*>;
+
+    LeafPtr leaf_ = nullptr;
+    std::size_t pos_ = 0;
+    friend class BTree;
+    friend class Iterator<!Const>;
+
+    // operator-> for maps, which have no stored pair to point at.
+    struct ArrowProxy {
+      std::conditional_t<Const, const_reference, reference> ref;
+      const auto* operator->() const noexcept { return &ref; }
+    };
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = typename BTree::value_type;
+    using reference =
+        std::conditional_t<Const, typename BTree::const_reference,
+                           typename BTree::reference>;
+    using pointer =
+        std::conditional_t<kIsMap, ArrowProxy, const value_type*>;
+
+    Iterator() = default;
+    Iterator(LeafPtr leaf, std::size_t pos) : leaf_(leaf), pos_(pos) {}
+    template <bool C = Const>
+      requires C
+    Iterator(const Iterator<false>& other)
+        : leaf_(other.leaf_), pos_(other.pos_) {}
+
+    reference operator*() const {
+      if constexpr (kIsMap)
+        return reference(leaf_->keys.data()[pos_], leaf_->mapped.data()[pos_]);
+      else
+        return leaf_->keys.data()[pos_];
+    }
+    pointer operator->() const {
+      if constexpr (kIsMap)
+        return ArrowProxy{**this};
+      else
+        return leaf_->keys.data() + pos_;
+    }
+
+    bool operator==(const Iterator& o) const {
+      return leaf_ == o.leaf_ && pos_ == o.pos_;
+    }
+
+    Iterator& operator++() {
+      if (++pos_ == leaf_->count && leaf_->next) {
+        leaf_ = leaf_->next;
+        pos_ = 0;
+      }
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator t(*this);
+      ++(*this);
+      return t;
+    }
+    Iterator& operator--() {
+      if (pos_ == 0) {
+        leaf_ = leaf_->prev;
+        pos_ = leaf_->count;
+      }
+      --pos_;
+      return *this;
+    }
+    Iterator operator--(int) {
+      Iterator t(*this);
+      --(*this);
+      return t;
+    }
+  };
+
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  BTree() : BTree(Compare()) {}
+  explicit BTree(const Compare& comp, const Allocator& alloc = Allocator())
+      : comp_(comp), alloc_(alloc) {}
+
+  // Appending in order packs every leaf full, so a copy is both linear and
+  // denser than the original.
+  BTree(const BTree& other)
+      : BTree(other.comp_, AllocTraits::select_on_container_copy_construction(
+                               other.alloc_)) {
+    for (auto it = other.begin(); it != other.end(); ++it)
+      append(copy_of(it));
+  }
+
+  BTree(BTree&& other) noexcept
+      : root_(std::exchange(other.root_, nullptr)),
+        first_(std::exchange(other.first_, nullptr)),
+        last_(std::exchange(other.last_, nullptr)),
+        height_(std::exchange(other.height_, 0)),
+        size_(std::exchange(other.size_, 0)),
+        comp_(other.comp_),
+        alloc_(std::move(other.alloc_)) {}
+
+  BTree& operator=(const BTree& other) {
+    if (this != &other) {
+      BTree tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+  BTree& operator=(BTree&& other) noexcept {
+    if (this != &other) {
+      BTree tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  ~BTree() { clear(); }
+
+  iterator begin() noexcept {
+    return root_ ? iterator(first_, 0) : iterator();
+  }
+  const_iterator begin() const noexcept {
+    return root_ ? const_iterator(first_, 0) : const_iterator();
+  }
+  iterator end() noexcept {
+    return root_ ? iterator(last_, last_->count) : iterator();
+  }
+  const_iterator end() const noexcept {
+    return root_ ? const_iterator(last_, last_->count) : const_iterator();
+  }
+
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+  size_type height() const noexcept { return root_ ? height_ + 1 : 0; }
+  const Compare& key_comp() const noexcept { return comp_; }
+  allocator_type get_allocator() const { return alloc_; }
+
+  void clear() noexcept {
+    if (root_) destroy_subtree(root_, height_);
+    root_ = nullptr;
+    first_ = last_ = nullptr;
+    height_ = 0;
+    size_ = 0;
+  }
+
+  void swap(BTree& other) noexcept {
+    using std::swap;
+    swap(root_, other.root_);
+    swap(first_, other.first_);
+    swap(last_, other.last_);
+    swap(height_, other.height_);
+    swap(size_, other.size_);
+    swap(comp_, other.comp_);
+    swap(alloc_, other.alloc_);
+  }
+
+  // Mapped is built from args only once the key is known to be new.
+  template <class... Args>
+  std::pair<iterator, bool> insert_unique(Key key, Args&&... args) {
+    if (!root_) make_root();
+    auto [leaf, pos] = lower_leaf(key);
+    const iterator it = normalize(leaf, pos);
+    if (it != end() && !comp_(key, key_of(it))) return {it, false};
+    return {insert_at(leaf, pos,
+                      Entry{std::move(key),
+                            MappedHolder(std::forward<Args>(args)...)}),
+            true};
+  }
+
+  // Equivalent keys keep their insertion order.
+  template <class... Args>
+  iterator insert_equal(Key key, Args&&... args) {
+    if (!root_) make_root();
+    auto [leaf, pos] = upper_leaf(key);
+    return insert_at(
+        leaf, pos,
+        Entry{std::move(key), MappedHolder(std::forward<Args>(args)...)});
+  }
+
+  // Brings other's elements in, equivalent elements of other after this
+  // tree's; a unique tree leaves other the elements whose key is already
+  // here. With sizes within kRebuildRatio of each other and copyable
+  // elements, both trees are rebuilt from copies in one linear pass and
+  // swapped in; otherwise each element is moved over and erased from
+  // other. Either way, if an allocation, copy or comparison throws, every
+  // element is in exactly one of the two trees.
+  void merge(BTree& other) {
+    if constexpr (std::is_copy_constructible_v<Key> &&
+                  (!kIsMap || std::is_copy_constructible_v<Mapped>)) {
+      if (other.size_ * kRebuildRatio >= size_) {
+        rebuild_merge(other);
+        return;
+      }
+    }
+    for (auto it = other.begin(); it != other.end();)
+      it = move_in(it) ? other.erase(it) : std::next(it);
+  }
+
+  // Returns the element after the erased one.
+  iterator erase(const_iterator it) {
+    Leaf* leaf = const_cast<Leaf*>(it.leaf_);
+    std::size_t pos = it.pos_;
+    for_arrays(leaf,
+               [&](auto* a) { shift_erase(a, leaf->count, pos); });
+    --leaf->count;
+    --size_;
+    if (leaf != root_ && leaf->count < kMinLeaf) rebalance_leaf(leaf, pos);
+    return normalize(leaf, pos);
+  }
+
+  template <class K>
+  size_type erase_key(const K& key) {
+    size_type n = 0;
+    iterator it = lower_bound(key);
+    while (it != end() && !comp_(key, key_of(it))) {
+      it = erase(it);
+      ++n;
+    }
+    return n;
+  }
+
+  template <class K>
+  iterator find(const K& key) {
+    iterator it = lower_bound(key);
+    return (it != end() && !comp_(key, key_of(it))) ? it : end();
+  }
+  template <class K>
+  const_iterator find(const K& key) const {
+    const_iterator it = lower_bound(key);
+    return (it != end() && !comp_(key, key_of(it))) ? it : end();
+  }
+
+  template <class K>
+  iterator lower_bound(const K& key) {
+    if (!root_) return end();
+    auto [leaf, pos] = lower_leaf(key);
+    return normalize(leaf, pos);
+  }
+  template <class K>
+  const_iterator lower_bound(const K& key) const {
+    return const_cast<BTree*>(this)->lower_bound(key);
+  }
+
+  template <class K>
+  iterator upper_bound(const K& key) {
+    if (!root_) return end();
+    auto [leaf, pos] = upper_leaf(key);
+    return normalize(leaf, pos);
+  }
+  template <class K>
+  const_iterator upper_bound(const K& key) const {
+    return const_cast<BTree*>(this)->upper_bound(key);
+  }
+
+  template <class K>
+  size_type count(const K& key) const {
+    if constexpr (Multi) {
+      return static_cast<size_type>(
+          std::distance(lower_bound(key), upper_bound(key)));
+    } else {
+      return find(key) != end() ? 1 : 0;
+    }
+  }
+
+  static const Key& key_of(const_iterator it) noexcept {
+    return it.leaf_->keys.data()[it.pos_];
+  }
+  // A merge rebuilds both trees only when other holds at least this
+  // fraction of this tree's size; below it, moving elements one by one
+  // beats copying everything.
+  static constexpr std::size_t kRebuildRatio = 8;
+
+  void rebuild_merge(BTree& other) {
+    BTree merged(comp_, alloc_);
+    BTree rest(other.comp_, other.alloc_);
+    const BTree& self = *this;
+    const BTree& from = other;
+    auto a = self.begin();
+    auto b = from.begin();
+    while (a != self.end() || b != from.end()) {
+      if (a == self.end() || (b != from.end() && comp_(key_of(b), key_of(a))))
+        merged.append(copy_of(b++));
+      else if (!Multi && b != from.end() && !comp_(key_of(a), key_of(b)))
+        rest.append(copy_of(b++));
+      else
+        merged.append(copy_of(a++));
+    }
+    swap(merged);
+    other.swap(rest);
+  }
+
+  // Moves the element at from, which belongs to another tree, into this
+  // one; false when a unique tree already holds its key. insert_at leaves
+  // the entry intact when it throws, so the element then goes back.
+  bool move_in(iterator from) {
+    Key& key = from.leaf_->keys.data()[from.pos_];
+    if (!root_) make_root();
+    auto [leaf, pos] = Multi ? upper_leaf(key) : lower_leaf(key);
+    if constexpr (!Multi) {
+      const iterator at = normalize(leaf, pos);
+      if (at != end() && !comp_(key, key_of(at))) return false;
+    }
+    Entry e = [&] {
+      if constexpr (kIsMap)
+        return Entry{std::move(key),
+                     std::move(from.leaf_->mapped.data()[from.pos_])};
+      else
+        return Entry{std::move(key), {}};
+    }();
+    try {
+      insert_at(leaf, pos, std::move(e));
+    } catch (...) {
+      key = std::move(e.key);
+      if constexpr (kIsMap)
+        from.leaf_->mapped.data()[from.pos_] = std::move(e.mapped);
+      throw;
+    }
+    return true;
+  }
+
+  static Entry copy_of(const_iterator it) {
+    if constexpr (kIsMap)
+      return Entry{key_of(it), it.leaf_->mapped.data()[it.pos_]};
+    else
+      return Entry{key_of(it), {}};
+  }
+
+  // Checks key order against the separators, parent links, the leaf chain,
+  // that no node but the root is empty, and the size. For tests and
+  // debugging; O(n).
+  bool verify() const {
+    if (!root_) return size_ == 0 && !first_ && !last_;
+    if (root_->parent) return false;
+    std::size_t count = 0;
+    const Leaf* prev = nullptr;
+    if (!verify_node(root_, height_, nullptr, nullptr, count, prev))
+      return false;
+    return prev == last_ && !last_->next && count == size_;
+  }
+
+ private:
+  // ---- allocation ----
+
+  Leaf* new_leaf() {
+    LeafAlloc alloc(alloc_);
+    Leaf* leaf = LeafTraits::allocate(alloc, 1);
+    return ::new (static_cast<void*>(leaf)) Leaf;
+  }
+  void free_leaf(Leaf* leaf) noexcept {
+    LeafAlloc alloc(alloc_);
+    std::destroy_at(leaf);
+    LeafTraits::deallocate(alloc, leaf, 1);
+  }
+  Internal* new_internal() {
+    InternalAlloc alloc(alloc_);
+    Internal* node = InternalTraits::allocate(alloc, 1);
+    return ::new (static_cast<void*>(node)) Internal;
+  }
+  void free_internal(Internal* node) noexcept {
+    InternalAlloc alloc(alloc_);
+    std::destroy_at(node);
+    InternalTraits::deallocate(alloc, node, 1);
+  }
+
+  // Internal nodes allocated before a split cascade starts, so the cascade
+  // itself cannot fail halfway; leftovers are freed on scope exit.
+  class Reserve {
+   public:
+    explicit Reserve(BTree& tree) : tree_(tree) {}
+    Reserve(const Reserve&) = delete;
+    Reserve& operator=(const Reserve&) = delete;
+    ~Reserve() {
+      while (n_ > 0) tree_.free_internal(nodes_[--n_]);
+    }
+    void fill(std::size_t count) {
+      while (n_ < count) nodes_[n_++] = tree_.new_internal();
+    }
+    Internal* take() noexcept { return nodes_[--n_]; }
+
+   private:
+    BTree& tree_;
+    Internal* nodes_[kMaxHeight + 1];
+    std::size_t n_ = 0;
+  };
+
+  void make_root() {
+    Leaf* leaf = new_leaf();
+    root_ = first_ = last_ = leaf;
+    height_ = 0;
+  }
+
+  void destroy_subtree(NodeBase* n, std::size_t height) noexcept {
+    if (height == 0) {
+      Leaf* leaf = static_cast<Leaf*>(n);
+      for_arrays(leaf, [&](auto* a) { std::destroy_n(a, leaf->count); });
+      free_leaf(leaf);
+      return;
+    }
+    Internal* node = static_cast<Internal*>(n);
+    for (std::size_t i = 0; i <= node->count; ++i)
+      destroy_subtree(node->children[i], height - 1);
+    std::destroy_n(node->keys.data(), node->count);
+    free_internal(node);
+  }
+
+  // ---- slot arrays ----
+
+  // Applies f to the key array and, in a map, the mapped array of a leaf,
+  // or to the matching arrays of two leaves.
+  template <class F>
+  static void for_arrays(Leaf* leaf, F&& f) {
+    f(leaf->keys.data());
+    if constexpr (kIsMap) f(leaf->mapped.data());
+  }
+  template <class F>
+  static void for_arrays(Leaf* a, Leaf* b, F&& f) {
+    f(a->keys.data(), b->keys.data());
+    if constexpr (kIsMap) f(a->mapped.data(), b->mapped.data());
+  }
+
+  // Inserts v at i among the n live objects of a.
+  template <class T>
+  static void shift_insert(T* a, std::size_t n, std::size_t i, T&& v) {
+    if (i == n) {
+      std::construct_at(a + n, std::move(v));
+      return;
+    }
+    std::construct_at(a + n, std::move(a[n - 1]));
+    std::move_backward(a + i, a + n - 1, a + n);
+    a[i] = std::move(v);
+  }
+  template <class T>
+  static void shift_erase(T* a, std::size_t n, std::size_t i) {
+    std::move(a + i + 1, a + n, a + i);
+    std::destroy_at(a + n - 1);
+  }
+  // Moves n objects into the raw slots at dst, ending their lives at src.
+  template <class T>
+  static void relocate(T* src, std::size_t n, T* dst) {
+    for (std::size_t i = 0; i < n; ++i) {
+      std::construct_at(dst + i, std::move(src[i]));
+      std::destroy_at(src + i);
+    }
+  }
+
+  static void set_child(Internal* node, std::size_t i, NodeBase* child) {
+    node->children[i] = child;
+    child->parent = node;
+    child->position = static_cast<std::uint16_t>(i);
+  }
+
+  // ---- search ----
+
+  template <class K>
+  std::size_t lower_index(const Key* keys, std::size_t n, const K& key) const {
+    return static_cast<std::size_t>(
+        std::lower_bound(keys, keys + n, key, comp_) - keys);
+  }
+  template <class K>
+  std::size_t upper_index(const Key* keys, std::size_t n, const K& key) const {
+    return static_cast<std::size_t>(
+        std::upper_bound(keys, keys + n, key, comp_) - keys);
+  }
+
+  // The leaf slot where key would go before any equivalent element; the
+  // slot may be one past the leaf's last element.
+  template <class K>
+  std::pair<Leaf*, std::size_t> lower_leaf(const K& key) const {
+    NodeBase* n = root_;
+    for (std::size_t h = height_; h > 0; --h) {
+      Internal* node = static_cast<Internal*>(n);
+      n = node->children[lower_index(node->keys.data(), node->count, key)];
+    }
+    Leaf* leaf = static_cast<Leaf*>(n);
+    return {leaf, lower_index(leaf->keys.data(), leaf->count, key)};
+  }
+  template <class K>
+  std::pair<Leaf*, std::size_t> upper_leaf(const K& key) const {
+    NodeBase* n = root_;
+    for (std::size_t h = height_; h > 0; --h) {
+      Internal* node = static_cast<Internal*>(n);
+      n = node->children[upper_index(node->keys.data(), node->count, key)];
+    }
+    Leaf* leaf = static_cast<Leaf*>(n);
+    return {leaf, upper_index(leaf->keys.data(), leaf->count, key)};
+  }
+
+  // One past a leaf's last element is the next leaf's first.
+  static iterator normalize(Leaf* leaf, std::size_t pos) noexcept {
+    if (pos == leaf->count && leaf->next) return iterator(leaf->next, 0);
+    return iterator(leaf, pos);
+  }
+
+  // Every key of the subtree at n must lie within [lo, hi]; prev is the
+  // leaf visited last, which must chain to the next one.
+  bool verify_node(const NodeBase* n, std::size_t height, const Key* lo,
+                   const Key* hi, std::size_t& count,
+                   const Leaf*& prev) const {
+    if (n != root_ && n->count == 0) return false;
+    const Key* keys = height == 0
+                          ? static_cast<const Leaf*>(n)->keys.data()
+                          : static_cast<const Internal*>(n)->keys.data();
+    for (std::size_t i = 0; i < n->count; ++i) {
+      if (lo && comp_(keys[i], *lo)) return false;
+      if (hi && comp_(*hi, keys[i])) return false;
+      if (i > 0 && comp_(keys[i], keys[i - 1])) return false;
+    }
+    if (height == 0) {
+      const Leaf* leaf = static_cast<const Leaf*>(n);
+      if (leaf->prev != prev || (prev ? prev->next : first_) != leaf)
+        return false;
+      prev = leaf;
+      count += leaf->count;
+      return true;
+    }
+    const Internal* node = static_cast<const Internal*>(n);
+    for (std::size_t i = 0; i <= node->count; ++i) {
+      const NodeBase* child = node->children[i];
+      if (child->parent != node || child->position != i) return false;
+      if (!verify_node(child, height - 1, i > 0 ? keys + i - 1 : lo,
+                       i < node->count ? keys + i : hi, count, prev))
+        return false;
+    }
+    return true;
+  }
+
+  // ---- insertion ----
+
+  void append(Entry&& e) {
+    if (!root_) make_root();
+    insert_at(last_, last_->count, std::move(e));
+  }
+
+  void leaf_insert(Leaf* leaf, std::size_t pos, Entry& e) {
+    shift_insert(leaf->keys.data(), leaf->count, pos, std::move(e.key));
+    if constexpr (kIsMap)
+      shift_insert(leaf->mapped.data(), leaf->count, pos,
+                   std::move(e.mapped));
+    ++leaf->count;
+    ++size_;
+  }
+
+  // New internal nodes a split of n would need: one per full ancestor, plus
+  // a root when every ancestor is full.
+  static std::size_t split_cost(const NodeBase* n) noexcept {
+    std::size_t need = 0;
+    for (const Internal* p = n->parent;; p = p->parent) {
+      if (!p) return need + 1;
+      if (p->count < kInnerSlots) return need;
+      ++need;
+    }
+  }
+
+  // Splitting at the insertion point's side when it is at either end of
+  // the node leaves the old node full, so sorted loads pack every node.
+  static std::size_t split_point(std::size_t pos, std::size_t slots) {
+    if (pos == slots) return slots;
+    if (pos == 0) return 0;
+    return slots / 2;
+  }
+
+  iterator insert_at(Leaf* leaf, std::size_t pos, Entry&& e) {
+    if (leaf->count < kLeafSlots) {
+      leaf_insert(leaf, pos, e);
+      return iterator(leaf, pos);
+    }
+
+    Reserve reserve(*this);
+    reserve.fill(split_cost(leaf));
+    const std::size_t keep = split_point(pos, kLeafSlots);
+    const bool to_right = pos > keep || keep == kLeafSlots;
+    // The right half's first key becomes the separator.
+    Key sep = (to_right && pos == keep) ? Key(e.key)
+                                        : Key(leaf->keys.data()[keep]);
+    Leaf* right = new_leaf();
+
+    for_arrays(leaf, right, [&](auto* a, auto* b) {
+      relocate(a + keep, kLeafSlots - keep, b);
+    });
+    right->count = static_cast<std::uint16_t>(kLeafSlots - keep);
+    leaf->count = static_cast<std::uint16_t>(keep);
+    right->prev = leaf;
+    right->next = leaf->next;
+    if (leaf->next)
+      leaf->next->prev = right;
+    else
+      last_ = right;
+    leaf->next = right;
+
+    Leaf* target = to_right ? right : leaf;
+    const std::size_t at = to_right ? pos - keep : pos;
+    leaf_insert(target, at, e);
+    insert_into_parent(leaf, std::move(sep), right, reserve);
+    return iterator(target, at);
+  }
+
+  // Adds right as the sibling after left, separated by sep, splitting
+  // ancestors as needed with nodes from reserve.
+  void insert_into_parent(NodeBase* left, Key&& sep, NodeBase* right,
+                          Reserve& reserve) noexcept {
+    Internal* p = left->parent;
+    if (!p) {
+      Internal* root = reserve.take();
+      std::construct_at(root->keys.data(), std::move(sep));
+      root->count = 1;
+      set_child(root, 0, left);
+      set_child(root, 1, right);
+      root_ = root;
+      ++height_;
+      return;
+    }
+    const std::size_t i = left->position;
+    if (p->count < kInnerSlots) {
+      inner_insert(p, i, std::move(sep), right);
+      return;
+    }
+
+    Internal* q = reserve.take();
+    const std::size_t mid = std::min(split_point(i, kInnerSlots),
+                                     kInnerSlots - 1);
+    Key* keys = p->keys.data();
+    Key up(std::move(keys[mid]));
+    std::destroy_at(keys + mid);
+    relocate(keys + mid + 1, kInnerSlots - mid - 1, q->keys.data());
+    for (std::size_t j = mid + 1; j <= kInnerSlots; ++j)
+      set_child(q, j - mid - 1, p->children[j]);
+    q->count = static_cast<std::uint16_t>(kInnerSlots - mid - 1);
+    p->count = static_cast<std::uint16_t>(mid);
+
+    if (i <= mid)
+      inner_insert(p, i, std::move(sep), right);
+    else
+      inner_insert(q, i - mid - 1, std::move(sep), right);
+    insert_into_parent(p, std::move(up), q, reserve);
+  }
+
+  // Inserts key i and child i + 1 into a node with room.
+  static void inner_insert(Internal* node, std::size_t i, Key&& sep,
+                           NodeBase* child) noexcept {
+    shift_insert(node->keys.data(), node->count, i, std::move(sep));
+    for (std::size_t j = node->count + 1; j > i + 1; --j)
+      set_child(node, j, node->children[j - 1]);
+    set_child(node, i + 1, child);
+    ++node->count;
+  }
+
+  // ---- erasure ----
+
+  // Removes key i and child i + 1.
+  static void inner_remove(Internal* node, std::size_t i) noexcept {
+    shift_erase(node->keys.data(), node->count, i);
+    for (std::size_t j = i + 1; j < node->count; ++j)
+      set_child(node, j, node->children[j + 1]);
+    --node->count;
+  }
+
+  void unlink_leaf(Leaf* leaf) noexcept {
+    if (leaf->prev)
+      leaf->prev->next = leaf->next;
+    else
+      first_ = leaf->next;
+    if (leaf->next)
+      leaf->next->prev = leaf->prev;
+    else
+      last_ = leaf->prev;
+  }
+
+  // Refills an underfull leaf from a sibling, or merges the two; leaf and
+  // pos follow the element that came after the erased one.
+  void rebalance_leaf(Leaf*& leaf, std::size_t& pos) {
+    Internal* p = leaf->parent;
+    const std::size_t i = leaf->position;
+    if (i > 0) {
+      Leaf* left = static_cast<Leaf*>(p->children[i - 1]);
+      const std::size_t last = left->count - 1u;
+      if (left->count > kMinLeaf) {
+        Key sep(left->keys.data()[last]);
+        for_arrays(left, leaf, [&](auto* a, auto* b) {
+          shift_insert(b, leaf->count, 0, std::move(a[last]));
+          std::destroy_at(a + last);
+        });
+        --left->count;
+        ++leaf->count;
+        ++pos;
+        p->keys.data()[i - 1] = std::move(sep);
+        return;
+      }
+      const std::size_t base = left->count;
+      for_arrays(leaf, left, [&](auto* a, auto* b) {
+        relocate(a, leaf->count, b + base);
+      });
+      left->count = static_cast<std::uint16_t>(base + leaf->count);
+      pos += base;
+      unlink_leaf(leaf);
+      inner_remove(p, i - 1);
+      free_leaf(leaf);
+      leaf = left;
+    } else {
+      Leaf* right = static_cast<Leaf*>(p->children[1]);
+      if (right->count > kMinLeaf) {
+        Key sep(right->keys.data()[1]);
+        for_arrays(right, leaf, [&](auto* a, auto* b) {
+          std::construct_at(b + leaf->count, std::move(a[0]));
+          shift_erase(a, right->count, 0);
+        });
+        --right->count;
+        ++leaf->count;
+        p->keys.data()[0] = std::move(sep);
+        return;
+      }
+      for_arrays(right, leaf, [&](auto* a, auto* b) {
+        relocate(a, right->count, b + leaf->count);
+      });
+      leaf->count = static_cast<std::uint16_t>(leaf->count + right->count);
+      unlink_leaf(right);
+      inner_remove(p, 0);
+      free_leaf(right);
+    }
+    after_remove(p);
+  }
+
+  void after_remove(Internal* node) noexcept {
+    if (node == root_) {
+      if (node->count == 0) {
+        root_ = node->children[0];
+        root_->parent = nullptr;
+        root_->position = 0;
+        free_internal(node);
+        --height_;
+      }
+      return;
+    }
+    if (node->count < kMinInner) rebalance_internal(node);
+  }
+
+  // Rotates a key through the parent from a sibling with spare keys, or
+  // merges with the sibling around their separator.
+  void rebalance_internal(Internal* node) noexcept {
+    Internal* p = node->parent;
+    const std::size_t i = node->position;
+    Key* pkeys = p->keys.data();
+    if (i > 0) {
+      Internal* left = static_cast<Internal*>(p->children[i - 1]);
+      Key* lkeys = left->keys.data();
+      if (left->count > kMinInner) {
+        shift_insert(node->keys.data(), node->count, 0,
+                     std::move(pkeys[i - 1]));
+        for (std::size_t j = node->count + 1u; j > 0; --j)
+          set_child(node, j, node->children[j - 1]);
+        set_child(node, 0, left->children[left->count]);
+        ++node->count;
+        pkeys[i - 1] = std::move(lkeys[left->count - 1]);
+        std::destroy_at(lkeys + left->count - 1);
+        --left->count;
+        return;
+      }
+      merge_internal(left, node, i - 1);
+    } else {
+      Internal* right = static_cast<Internal*>(p->children[1]);
+      Key* rkeys = right->keys.data();
+      if (right->count > kMinInner) {
+        std::construct_at(node->keys.data() + node->count,
+                          std::move(pkeys[0]));
+        set_child(node, node->count + 1u, right->children[0]);
+        ++node->count;
+        pkeys[0] = std::move(rkeys[0]);
+        shift_erase(rkeys, right->count, 0);
+        for (std::size_t j = 0; j < right->count; ++j)
+          set_child(right, j, right->children[j + 1]);
+        --right->count;
+        return;
+      }
+      merge_internal(node, right, 0);
+    }
+    after_remove(p);
+  }
+
+  // Appends the separator at index k of the parent and all of right to
+  // left, then drops right.
+  void merge_internal(Internal* left, Internal* right, std::size_t k) noexcept {
+    Internal* p = left->parent;
+    Key* lkeys = left->keys.data();
+    std::construct_at(lkeys + left->count, std::move(p->keys.data()[k]));
+    relocate(right->keys.data(), right->count, lkeys + left->count + 1);
+    for (std::size_t j = 0; j <= right->count; ++j)
+      set_child(left, left->count + 1u + j, right->children[j]);
+    left->count = static_cast<std::uint16_t>(left->count + 1u + right->count);
+    inner_remove(p, k);
+    free_internal(right);
+  }
+};
+
+}  // namespace s21
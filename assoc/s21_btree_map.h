@@ -0,0 +1,220 @@
+#pragma once
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "s21_btree.h"
+
+namespace s21 {
+
+// Ordered map on a B+ tree: the s21::map interface with far fewer cache
+// misses per lookup and contiguous scans. Keys and values sit in separate
+// arrays inside a node, so dereferencing an iterator yields a
+// std::pair<const Key&, T&> rather than a value_type&. Any insertion or
+// erasure invalidates all iterators.
+template <class Key, class T, class Compare = std::less<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>>
+class btree_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+
+  using tree_type = BTree<Key, T, Compare, Allocator, false>;
+  using reference = typename tree_type::reference;
+  using const_reference = typename tree_type::const_reference;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+
+ private:
+  tree_type tree_;
+
+ public:
+  btree_map() = default;
+  explicit btree_map(const Compare& comp,
+                     const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {}
+  explicit btree_map(const Allocator& alloc) : tree_(Compare(), alloc) {}
+
+  btree_map(std::initializer_list<value_type> items,
+            const Compare& comp = Compare(),
+            const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    for (const auto& kv : items) insert(kv);
+  }
+
+  template <std::input_iterator InputIt>
+  btree_map(InputIt first, InputIt last, const Compare& comp = Compare(),
+            const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    for (; first != last; ++first) insert(*first);
+  }
+
+  btree_map(const btree_map&) = default;
+  btree_map(btree_map&&) noexcept = default;
+  ~btree_map() = default;
+  btree_map& operator=(const btree_map&) = default;
+  btree_map& operator=(btree_map&&) noexcept = default;
+
+  iterator begin() noexcept { return tree_.begin(); }
+  const_iterator begin() const noexcept { return tree_.begin(); }
+  iterator end() noexcept { return tree_.end(); }
+  const_iterator end() const noexcept { return tree_.end(); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return tree_.empty(); }
+  size_type size() const noexcept { return tree_.size(); }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() /
+           (sizeof(Key) + sizeof(T));
+  }
+
+  void clear() noexcept { tree_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return tree_.insert_unique(value.first, value.second);
+  }
+  std::pair<iterator, bool> insert(const key_type& key,
+                                   const mapped_type& obj) {
+    return tree_.insert_unique(key, obj);
+  }
+  std::pair<iterator, bool> insert_or_assign(const key_type& key,
+                                             const mapped_type& obj) {
+    auto it = find(key);
+    if (it != end()) {
+      (*it).second = obj;
+      return {it, false};
+    }
+    return tree_.insert_unique(key, obj);
+  }
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    std::pair<Key, T> kv(std::forward<Args>(args)...);
+    return tree_.insert_unique(std::move(kv.first), std::move(kv.second));
+  }
+
+  // Returns the element that followed pos.
+  iterator erase(const_iterator pos) {
+    if (pos == cend()) return end();
+    return tree_.erase(pos);
+  }
+  size_type erase(const key_type& key) { return tree_.erase_key(key); }
+
+  void swap(btree_map& other) noexcept { tree_.swap(other.tree_); }
+
+  // Takes in every element whose key is not present yet; the rest stay in
+  // other, still in order. If anything throws, each element is in exactly
+  // one of the two containers.
+  void merge(btree_map& other) {
+    if (this != &other) tree_.merge(other.tree_);
+  }
+
+  mapped_type& at(const key_type& key) {
+    auto it = find(key);
+    if (it == end()) throw std::out_of_range("btree_map::at: key not found");
+    return (*it).second;
+  }
+  const mapped_type& at(const key_type& key) const {
+    auto it = find(key);
+    if (it == end()) throw std::out_of_range("btree_map::at: key not found");
+    return (*it).second;
+  }
+  mapped_type& operator[](const key_type& key) {
+    return (*tree_.insert_unique(key).first).second;
+  }
+
+  iterator find(const key_type& key) { return tree_.find(key); }
+  const_iterator find(const key_type& key) const { return tree_.find(key); }
+  template <class K>
+    requires transparent_compare<Compare>
+  iterator find(const K& key) {
+    return tree_.find(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  const_iterator find(const K& key) const {
+    return tree_.find(key);
+  }
+
+  bool contains(const key_type& key) const { return find(key) != end(); }
+  template <class K>
+    requires transparent_compare<Compare>
+  bool contains(const K& key) const {
+    return find(key) != end();
+  }
+
+  size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+  template <class K>
+    requires transparent_compare<Compare>
+  size_type count(const K& key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  iterator lower_bound(const key_type& key) { return tree_.lower_bound(key); }
+  const_iterator lower_bound(const key_type& key) const {
+    return tree_.lower_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  iterator lower_bound(const K& key) {
+    return tree_.lower_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  const_iterator lower_bound(const K& key) const {
+    return tree_.lower_bound(key);
+  }
+
+  iterator upper_bound(const key_type& key) { return tree_.upper_bound(key); }
+  const_iterator upper_bound(const key_type& key) const {
+    return tree_.upper_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  iterator upper_bound(const K& key) {
+    return tree_.upper_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  const_iterator upper_bound(const K& key) const {
+    return tree_.upper_bound(key);
+  }
+
+  key_compare key_comp() const { return tree_.key_comp(); }
+  allocator_type get_allocator() const { return tree_.get_allocator(); }
+
+  // Insertions move elements around, so the returned iterators are looked
+  // up again once every element is in.
+  template <class... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    std::vector<key_type> keys;
+    std::vector<bool> inserted;
+    keys.reserve(sizeof...(args));
+    inserted.reserve(sizeof...(args));
+    (
+        [&](auto&& v) {
+          value_type kv(std::forward<decltype(v)>(v));
+          keys.push_back(kv.first);
+          inserted.push_back(
+              tree_.insert_unique(kv.first, std::move(kv.second)).second);
+        }(std::forward<Args>(args)),
+        ...);
+    std::vector<std::pair<iterator, bool>> res;
+    res.reserve(keys.size());
+    for (std::size_t i = 0; i < keys.size(); ++i)
+      res.emplace_back(find(keys[i]), inserted[i]);
+    return res;
+  }
+};
+
+}  // namespace s21
@@ -0,0 +1,207 @@
+#pragma once
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "s21_btree.h"
+
+namespace s21 {
+
+// Ordered multiset on a B+ tree with the s21::multiset interface;
+// equivalent keys keep their insertion order. Any insertion or erasure
+// invalidates all iterators.
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+class btree_multiset {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = const value_type&;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using allocator_type = Allocator;
+
+  using tree_type = BTree<Key, void, Compare, Allocator, true>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+
+ private:
+  tree_type tree_;
+
+ public:
+  btree_multiset() = default;
+  explicit btree_multiset(const Compare& comp,
+                          const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {}
+  explicit btree_multiset(const Allocator& alloc) : tree_(Compare(), alloc) {}
+
+  btree_multiset(std::initializer_list<value_type> items,
+                 const Compare& comp = Compare(),
+                 const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    for (const auto& key : items) insert(key);
+  }
+
+  template <std::input_iterator InputIt>
+  btree_multiset(InputIt first, InputIt last,
+                 const Compare& comp = Compare(),
+                 const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    for (; first != last; ++first) insert(*first);
+  }
+
+  btree_multiset(const btree_multiset&) = default;
+  btree_multiset(btree_multiset&&) noexcept = default;
+  ~btree_multiset() = default;
+  btree_multiset& operator=(const btree_multiset&) = default;
+  btree_multiset& operator=(btree_multiset&&) noexcept = default;
+
+  iterator begin() noexcept { return tree_.begin(); }
+  const_iterator begin() const noexcept { return tree_.begin(); }
+  iterator end() noexcept { return tree_.end(); }
+  const_iterator end() const noexcept { return tree_.end(); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return tree_.empty(); }
+  size_type size() const noexcept { return tree_.size(); }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type);
+  }
+
+  void clear() noexcept { tree_.clear(); }
+
+  iterator insert(const value_type& value) {
+    return tree_.insert_equal(value);
+  }
+  iterator insert(value_type&& value) {
+    return tree_.insert_equal(std::move(value));
+  }
+  template <class... Args>
+  iterator emplace(Args&&... args) {
+    return tree_.insert_equal(Key(std::forward<Args>(args)...));
+  }
+
+  // Returns the element that followed pos.
+  iterator erase(const_iterator pos) {
+    if (pos == cend()) return end();
+    return tree_.erase(pos);
+  }
+  size_type erase(const key_type& key) { return tree_.erase_key(key); }
+
+  void swap(btree_multiset& other) noexcept { tree_.swap(other.tree_); }
+
+  // Takes every key of other. If anything throws, each key is in exactly
+  // one of the two containers.
+  void merge(btree_multiset& other) {
+    if (this != &other) tree_.merge(other.tree_);
+  }
+
+  iterator find(const key_type& key) { return tree_.find(key); }
+  const_iterator find(const key_type& key) const { return tree_.find(key); }
+  template <class K>
+    requires transparent_compare<Compare>
+  iterator find(const K& key) {
+    return tree_.find(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  const_iterator find(const K& key) const {
+    return tree_.find(key);
+  }
+
+  bool contains(const key_type& key) const { return find(key) != end(); }
+  template <class K>
+    requires transparent_compare<Compare>
+  bool contains(const K& key) const {
+    return find(key) != end();
+  }
+
+  size_type count(const key_type& key) const { return tree_.count(key); }
+  template <class K>
+    requires transparent_compare<Compare>
+  size_type count(const K& key) const {
+    return tree_.count(key);
+  }
+
+  iterator lower_bound(const key_type& key) { return tree_.lower_bound(key); }
+  const_iterator lower_bound(const key_type& key) const {
+    return tree_.lower_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  iterator lower_bound(const K& key) {
+    return tree_.lower_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  const_iterator lower_bound(const K& key) const {
+    return tree_.lower_bound(key);
+  }
+
+  iterator upper_bound(const key_type& key) { return tree_.upper_bound(key); }
+  const_iterator upper_bound(const key_type& key) const {
+    return tree_.upper_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  iterator upper_bound(const K& key) {
+    return tree_.upper_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  const_iterator upper_bound(const K& key) const {
+    return tree_.upper_bound(key);
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type& key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type& key) const {
+    return {lower_bound(key), upper_bound(key)};
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  std::pair<iterator, iterator> equal_range(const K& key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  std::pair<const_iterator, const_iterator> equal_range(const K& key) const {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  key_compare key_comp() const { return tree_.key_comp(); }
+  value_compare value_comp() const { return tree_.key_comp(); }
+  allocator_type get_allocator() const { return tree_.get_allocator(); }
+
+  // Insertions move elements around, so the returned iterators are found
+  // again at the end: each new element sits after its equivalents, behind
+  // any equivalent ones inserted later in the same call.
+  template <class... Args>
+  std::vector<iterator> insert_many(Args&&... args) {
+    std::vector<key_type> keys{key_type(std::forward<Args>(args))...};
+    for (const auto& key : keys) tree_.insert_equal(key);
+    const Compare& comp = tree_.key_comp();
+    std::vector<iterator> res;
+    res.reserve(keys.size());
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      std::size_t later = 0;
+      for (std::size_t j = i + 1; j < keys.size(); ++j)
+        if (!comp(keys[i], keys[j]) && !comp(keys[j], keys[i])) ++later;
+      iterator it = upper_bound(keys[i]);
+      for (std::size_t k = 0; k <= later; ++k) --it;
+      res.push_back(it);
+    }
+    return res;
+  }
+};
+
+}  // namespace s21
@@ -0,0 +1,182 @@
+#pragma once
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "s21_btree.h"
+
+namespace s21 {
+
+// Ordered set on a B+ tree with the s21::set interface. Any insertion or
+// erasure invalidates all iterators.
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+class btree_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = const value_type&;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using allocator_type = Allocator;
+
+  using tree_type = BTree<Key, void, Compare, Allocator, false>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+
+ private:
+  tree_type tree_;
+
+ public:
+  btree_set() = default;
+  explicit btree_set(const Compare& comp,
+                     const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {}
+  explicit btree_set(const Allocator& alloc) : tree_(Compare(), alloc) {}
+
+  btree_set(std::initializer_list<value_type> items,
+            const Compare& comp = Compare(),
+            const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    for (const auto& key : items) insert(key);
+  }
+
+  template <std::input_iterator InputIt>
+  btree_set(InputIt first, InputIt last, const Compare& comp = Compare(),
+            const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    for (; first != last; ++first) insert(*first);
+  }
+
+  btree_set(const btree_set&) = default;
+  btree_set(btree_set&&) noexcept = default;
+  ~btree_set() = default;
+  btree_set& operator=(const btree_set&) = default;
+  btree_set& operator=(btree_set&&) noexcept = default;
+
+  iterator begin() noexcept { return tree_.begin(); }
+  const_iterator begin() const noexcept { return tree_.begin(); }
+  iterator end() noexcept { return tree_.end(); }
+  const_iterator end() const noexcept { return tree_.end(); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return tree_.empty(); }
+  size_type size() const noexcept { return tree_.size(); }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type);
+  }
+
+  void clear() noexcept { tree_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return tree_.insert_unique(value);
+  }
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return tree_.insert_unique(std::move(value));
+  }
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return tree_.insert_unique(Key(std::forward<Args>(args)...));
+  }
+
+  // Returns the element that followed pos.
+  iterator erase(const_iterator pos) {
+    if (pos == cend()) return end();
+    return tree_.erase(pos);
+  }
+  size_type erase(const key_type& key) { return tree_.erase_key(key); }
+
+  void swap(btree_set& other) noexcept { tree_.swap(other.tree_); }
+
+  // Takes in every key not present yet; the rest stay in other. If
+  // anything throws, each key is in exactly one of the two containers.
+  void merge(btree_set& other) {
+    if (this != &other) tree_.merge(other.tree_);
+  }
+
+  iterator find(const key_type& key) { return tree_.find(key); }
+  const_iterator find(const key_type& key) const { return tree_.find(key); }
+  template <class K>
+    requires transparent_compare<Compare>
+  iterator find(const K& key) {
+    return tree_.find(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  const_iterator find(const K& key) const {
+    return tree_.find(key);
+  }
+
+  bool contains(const key_type& key) const { return find(key) != end(); }
+  template <class K>
+    requires transparent_compare<Compare>
+  bool contains(const K& key) const {
+    return find(key) != end();
+  }
+
+  size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+  template <class K>
+    requires transparent_compare<Compare>
+  size_type count(const K& key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  iterator lower_bound(const key_type& key) { return tree_.lower_bound(key); }
+  const_iterator lower_bound(const key_type& key) const {
+    return tree_.lower_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  iterator lower_bound(const K& key) {
+    return tree_.lower_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  const_iterator lower_bound(const K& key) const {
+    return tree_.lower_bound(key);
+  }
+
+  iterator upper_bound(const key_type& key) { return tree_.upper_bound(key); }
+  const_iterator upper_bound(const key_type& key) const {
+    return tree_.upper_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  iterator upper_bound(const K& key) {
+    return tree_.upper_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  const_iterator upper_bound(const K& key) const {
+    return tree_.upper_bound(key);
+  }
+
+  key_compare key_comp() const { return tree_.key_comp(); }
+  value_compare value_comp() const { return tree_.key_comp(); }
+  allocator_type get_allocator() const { return tree_.get_allocator(); }
+
+  // Insertions move elements around, so the returned iterators are looked
+  // up again once every key is in.
+  template <class... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    std::vector<key_type> keys{key_type(std::forward<Args>(args))...};
+    std::vector<bool> inserted;
+    inserted.reserve(keys.size());
+    for (const auto& key : keys)
+      inserted.push_back(tree_.insert_unique(key).second);
+    std::vector<std::pair<iterator, bool>> res;
+    res.reserve(keys.size());
+    for (std::size_t i = 0; i < keys.size(); ++i)
+      res.emplace_back(find(keys[i]), inserted[i]);
+    return res;
+  }
+};
+
+}  // namespace s21
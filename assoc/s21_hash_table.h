@@ -0,0 +1,715 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "s21_redblack_tree.h"
+
+namespace s21 {
+
+// Hash and equality functors that both accept any key-like operand (both
+// define is_transparent); lookups then hash and compare the argument as-is
+// instead of converting it to Key first.
+template <class Hash, class KeyEqual>
+concept transparent_hash = requires {
+  typename Hash::is_transparent;
+  typename KeyEqual::is_transparent;
+};
+
+// Control bytes of an open-addressing table, one per slot: a full slot
+// holds the low seven bits of its hash (0..127), the rest hold a marker.
+// The sentinel ends iteration after the last slot.
+inline constexpr std::int8_t kHashEmpty = -128;
+inline constexpr std::int8_t kHashDeleted = -2;
+inline constexpr std::int8_t kHashSentinel = -1;
+
+// Control bytes of a table with no slots: lookups stop at the first group
+// and iteration at the sentinel, with no branch for the empty case.
+alignas(16) inline constexpr std::int8_t kHashEmptyGroup[16] = {
+    kHashSentinel, kHashEmpty, kHashEmpty, kHashEmpty,
+    kHashEmpty,    kHashEmpty, kHashEmpty, kHashEmpty,
+    kHashEmpty,    kHashEmpty, kHashEmpty, kHashEmpty,
+    kHashEmpty,    kHashEmpty, kHashEmpty, kHashEmpty};
+
+// Positions within a probed group, lowest first; each position takes
+// 1 << Shift bits of the mask.
+template <std::size_t Width, unsigned Shift>
+class hash_bitmask {
+ public:
+  explicit hash_bitmask(std::uint64_t bits) noexcept : bits_(bits) {}
+
+  explicit operator bool() const noexcept { return bits_ != 0; }
+  std::size_t lowest() const noexcept {
+    return static_cast<std::size_t>(std::countr_zero(bits_)) >> Shift;
+  }
+  void clear_lowest() noexcept { bits_ &= bits_ - 1; }
+  // Positions after the highest one in the mask.
+  std::size_t trailing_gap() const noexcept {
+    constexpr int kUnused = 64 - static_cast<int>(Width << Shift);
+    return static_cast<std::size_t>(std::countl_zero(bits_) - kUnused) >>
+           Shift;
+  }
+
+ private:
+  std::uint64_t bits_;
+};
+
+#if defined(__SSE2__)
+
+// Sixteen control bytes matched at once with SSE2 compares.
+class hash_group {
+ public:
+  static constexpr std::size_t kWidth = 16;
+  using mask = hash_bitmask<kWidth, 0>;
+
+  explicit hash_group(const std::int8_t* ctrl) noexcept
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+  mask match(std::int8_t h2) const noexcept {
+    return bits(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_));
+  }
+  mask match_empty() const noexcept { return match(kHashEmpty); }
+  // Empty and deleted are the only markers below the sentinel.
+  mask match_empty_or_deleted() const noexcept {
+    return bits(_mm_cmpgt_epi8(_mm_set1_epi8(kHashSentinel), ctrl_));
+  }
+  std::size_t count_leading_empty_or_deleted() const noexcept {
+    const auto m = static_cast<std::uint32_t>(_mm_movemask_epi8(
+        _mm_cmpgt_epi8(_mm_set1_epi8(kHashSentinel), ctrl_)));
+    return static_cast<std::size_t>(std::countr_one(m));
+  }
+
+ private:
+  static mask bits(__m128i v) noexcept {
+    return mask(static_cast<std::uint16_t>(_mm_movemask_epi8(v)));
+  }
+
+  __m128i ctrl_;
+};
+
+#else
+
+// Eight control bytes matched at once in a 64-bit word. match() may also
+// report a full slot right after a true match; callers compare keys anyway.
+class hash_group {
+ public:
+  static constexpr std::size_t kWidth = 8;
+  using mask = hash_bitmask<kWidth, 3>;
+
+  explicit hash_group(const std::int8_t* ctrl) noexcept {
+    std::memcpy(&ctrl_, ctrl, sizeof(ctrl_));
+    if constexpr (std::endian::native == std::endian::big)
+      ctrl_ = __builtin_bswap64(ctrl_);
+  }
+
+  mask match(std::int8_t h2) const noexcept {
+    const std::uint64_t x = ctrl_ ^ (kLsbs * static_cast<std::uint8_t>(h2));
+    return mask((x - kLsbs) & ~x & kMsbs);
+  }
+  // Empty is the only marker with the top bit set and bit 1 clear.
+  mask match_empty() const noexcept {
+    return mask(ctrl_ & ~(ctrl_ << 6) & kMsbs);
+  }
+  // Empty and deleted are the only markers with bit 0 clear.
+  mask match_empty_or_deleted() const noexcept {
+    return mask(ctrl_ & ~(ctrl_ << 7) & kMsbs);
+  }
+  std::size_t count_leading_empty_or_deleted() const noexcept {
+    const std::uint64_t m = (ctrl_ & ~(ctrl_ << 7) & kMsbs) | ~kMsbs;
+    return static_cast<std::size_t>(std::countr_one(m)) >> 3;
+  }
+
+ private:
+  static constexpr std::uint64_t kLsbs = 0x0101010101010101ull;
+  static constexpr std::uint64_t kMsbs = 0x8080808080808080ull;
+
+  std::uint64_t ctrl_;
+};
+
+#endif
+
+// How a table stores its elements. A plain Value sits in the slot as is;
+// transfer() moves it to another slot and ends the old one's lifetime.
+template <class Value>
+struct hash_slot_policy {
+  using slot_type = Value;
+
+  static constexpr bool kNothrowTransfer =
+      std::is_nothrow_move_constructible_v<Value>;
+
+  static Value* element(slot_type* slot) noexcept { return slot; }
+  static const Value* element(const slot_type* slot) noexcept { return slot; }
+
+  static void transfer(slot_type* to, slot_type* from) noexcept(
+      kNothrowTransfer) {
+    std::construct_at(to, std::move(*from));
+    std::destroy_at(from);
+  }
+};
+
+// A map's pair<const K, T> shares its slot with pair<K, T>, as abseil's
+// map_slot_type does: users only see the const-key member, and rehashing
+// moves the key through the mutable one instead of copying it.
+template <class K, class T>
+union hash_map_slot {
+  hash_map_slot() {}
+  ~hash_map_slot() {}
+
+  std::pair<const K, T> value;
+  std::pair<K, T> mutable_value;
+};
+
+template <class K, class T>
+struct hash_slot_policy<std::pair<const K, T>> {
+  using Value = std::pair<const K, T>;
+  using MutableValue = std::pair<K, T>;
+  using slot_type = hash_map_slot<K, T>;
+
+  // Both members must be laid out alike for the key to be moved through
+  // the mutable one; otherwise the move copies the key.
+  static constexpr bool same_layout() noexcept {
+    if constexpr (std::is_standard_layout_v<Value> &&
+                  std::is_standard_layout_v<MutableValue>)
+      return offsetof(Value, first) == offsetof(MutableValue, first) &&
+             offsetof(Value, second) == offsetof(MutableValue, second);
+    else
+      return false;
+  }
+  static constexpr bool kMutableKeys = same_layout();
+  static constexpr bool kNothrowTransfer =
+      kMutableKeys ? std::is_nothrow_move_constructible_v<MutableValue>
+                   : std::is_nothrow_move_constructible_v<Value>;
+
+  static Value* element(slot_type* slot) noexcept { return &slot->value; }
+  static const Value* element(const slot_type* slot) noexcept {
+    return &slot->value;
+  }
+
+  static void transfer(slot_type* to, slot_type* from) noexcept(
+      kNothrowTransfer) {
+    if constexpr (kMutableKeys) {
+      std::construct_at(&to->mutable_value, std::move(from->mutable_value));
+      std::destroy_at(&from->mutable_value);
+    } else {
+      std::construct_at(&to->value, std::move(from->value));
+      std::destroy_at(&from->value);
+    }
+  }
+};
+
+// Open-addressing table behind unordered_map and unordered_set, laid out
+// as a Swiss table: a control byte per slot holds seven bits of the slot's
+// hash, and a lookup compares a whole group of control bytes at once, so
+// it usually touches one control group and one slot. Capacity is 2^k - 1
+// with the sentinel after the last slot and a copy of the first group's
+// bytes after the sentinel, so a group can be loaded at any slot.
+//
+// Rehashing moves elements into new slots, so it invalidates iterators and
+// references; erasure only invalidates the erased element. When moving an
+// element may throw, rehashing copies the elements instead and leaves the
+// table as it was if a copy throws. Hashing a key is assumed not to throw.
+template <typename Key, typename Value, typename KeyOfValue, typename Hash,
+          typename KeyEqual, typename Allocator>
+class HashTable {
+  using Policy = hash_slot_policy<Value>;
+  using Slot = typename Policy::slot_type;
+  using AllocTraits = std::allocator_traits<Allocator>;
+  using SlotAlloc = typename AllocTraits::template rebind_alloc<Slot>;
+  using SlotTraits = std::allocator_traits<SlotAlloc>;
+  using CtrlAlloc = typename AllocTraits::template rebind_alloc<std::int8_t>;
+  using CtrlTraits = std::allocator_traits<CtrlAlloc>;
+
+  static constexpr std::size_t kWidth = hash_group::kWidth;
+  static constexpr std::size_t kCloned = kWidth - 1;
+
+  std::int8_t* ctrl_ = const_cast<std::int8_t*>(kHashEmptyGroup);
+  Slot* slots_ = nullptr;
+  std::size_t capacity_ = 0;     // 2^k - 1 slots, or 0 with no arrays
+  std::size_t size_ = 0;
+  std::size_t growth_left_ = 0;  // insertions into empty slots before growth
+  [[no_unique_address]] Hash hash_;
+  [[no_unique_address]] KeyEqual eq_;
+  [[no_unique_address]] Allocator alloc_;
+
+ public:
+  using key_type = Key;
+  using value_type = Value;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+
+  template <bool Const>
+  class Iterator {
+    using SlotPtr = std::conditional_t<Const, const Slot*, Slot*>;
+
+    const std::int8_t* ctrl_ = nullptr;
+    SlotPtr slot_ = nullptr;
+    friend class HashTable;
+    friend class Iterator<!Const>;
+
+    Iterator(const std::int8_t* ctrl, SlotPtr slot)
+        : ctrl_(ctrl), slot_(slot) {}
+
+    // Advances to the next full slot or the sentinel.
+    void skip_free() noexcept {
+      while (*ctrl_ < kHashSentinel) {
+        const std::size_t n =
+            hash_group(ctrl_).count_leading_empty_or_deleted();
+        ctrl_ += n;
+        slot_ += n;
+      }
+    }
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = Value;
+    using reference = std::conditional_t<Const, const Value&, Value&>;
+    using pointer = std::conditional_t<Const, const Value*, Value*>;
+
+    Iterator() = default;
+    template <bool C = Const>
+      requires C
+    Iterator(const Iterator<false>& other)
+        : ctrl_(other.ctrl_), slot_(other.slot_) {}
+
+    reference operator*() const noexcept { return *Policy::element(slot_); }
+    pointer operator->() const noexcept { return Policy::element(slot_); }
+
+    bool operator==(const Iterator& o) const noexcept {
+      return ctrl_ == o.ctrl_;
+    }
+
+    Iterator& operator++() noexcept {
+      ++ctrl_;
+      ++slot_;
+      skip_free();
+      return *this;
+    }
+    Iterator operator++(int) noexcept {
+      Iterator t(*this);
+      ++(*this);
+      return t;
+    }
+  };
+
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  HashTable() = default;
+  explicit HashTable(size_type bucket_count, const Hash& hash = Hash(),
+                     const KeyEqual& eq = KeyEqual(),
+                     const Allocator& alloc = Allocator())
+      : hash_(hash), eq_(eq), alloc_(alloc) {
+    if (bucket_count > 0) resize(normalize_capacity(bucket_count));
+  }
+
+  // Sized for other's elements, so no rehash happens while copying.
+  HashTable(const HashTable& other)
+      : HashTable(0, other.hash_, other.eq_,
+                  AllocTraits::select_on_container_copy_construction(
+                      other.alloc_)) {
+    reserve(other.size_);
+    for (const Value& v : other) {
+      const std::size_t hash = hash_of(KeyOfValue()(v));
+      const std::size_t i = find_first_free(hash);
+      std::construct_at(element_at(i), v);
+      commit(i, hash);
+    }
+  }
+
+  HashTable(HashTable&& other) noexcept
+      : ctrl_(std::exchange(other.ctrl_,
+                            const_cast<std::int8_t*>(kHashEmptyGroup))),
+        slots_(std::exchange(other.slots_, nullptr)),
+        capacity_(std::exchange(other.capacity_, 0)),
+        size_(std::exchange(other.size_, 0)),
+        growth_left_(std::exchange(other.growth_left_, 0)),
+        hash_(other.hash_),
+        eq_(other.eq_),
+        alloc_(std::move(other.alloc_)) {}
+
+  HashTable& operator=(const HashTable& other) {
+    if (this != &other) {
+      HashTable tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+  HashTable& operator=(HashTable&& other) noexcept {
+    if (this != &other) {
+      HashTable tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  ~HashTable() {
+    destroy_elements();
+    release(ctrl_, slots_, capacity_);
+  }
+
+  iterator begin() noexcept {
+    iterator it(ctrl_, slots_);
+    it.skip_free();
+    return it;
+  }
+  const_iterator begin() const noexcept {
+    return const_cast<HashTable*>(this)->begin();
+  }
+  iterator end() noexcept {
+    return iterator(ctrl_ + capacity_, slots_ + capacity_);
+  }
+  const_iterator end() const noexcept {
+    return const_cast<HashTable*>(this)->end();
+  }
+
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+  size_type capacity() const noexcept { return capacity_; }
+  static constexpr size_type max_size() noexcept {
+    return (std::numeric_limits<size_type>::max() >> 1) / sizeof(Slot);
+  }
+  // Elements per slot before the table grows.
+  static constexpr float max_load_factor() noexcept { return 0.875f; }
+  float load_factor() const noexcept {
+    return capacity_ ? static_cast<float>(size_) / capacity_ : 0.0f;
+  }
+  const Hash& hash_function() const noexcept { return hash_; }
+  const KeyEqual& key_eq() const noexcept { return eq_; }
+  allocator_type get_allocator() const { return alloc_; }
+
+  // Keeps the slots, so refilling to the same size does not rehash.
+  void clear() noexcept {
+    if (capacity_ == 0) return;
+    destroy_elements();
+    reset_ctrl(ctrl_, capacity_);
+    size_ = 0;
+    growth_left_ = growth_of(capacity_);
+  }
+
+  void swap(HashTable& other) noexcept {
+    using std::swap;
+    swap(ctrl_, other.ctrl_);
+    swap(slots_, other.slots_);
+    swap(capacity_, other.capacity_);
+    swap(size_, other.size_);
+    swap(growth_left_, other.growth_left_);
+    swap(hash_, other.hash_);
+    swap(eq_, other.eq_);
+    swap(alloc_, other.alloc_);
+  }
+
+  // Makes room for n elements in total, so that inserting up to n minus
+  // size() new keys neither rehashes nor invalidates iterators.
+  void reserve(size_type n) {
+    if (n <= size_ + growth_left_) return;
+    resize(normalize_capacity(capacity_for(n)));
+  }
+  // Rehashes into at least n slots, shrinking when n is below the current
+  // capacity; never below what size() needs.
+  void rehash(size_type n) {
+    if (n == 0 && size_ == 0) {
+      destroy_elements();
+      release(ctrl_, slots_, capacity_);
+      ctrl_ = const_cast<std::int8_t*>(kHashEmptyGroup);
+      slots_ = nullptr;
+      capacity_ = growth_left_ = 0;
+      return;
+    }
+    const size_type target =
+        normalize_capacity(std::max(n, capacity_for(size_)));
+    if (target != capacity_ || growth_left_ != growth_of(capacity_) - size_)
+      resize(target);
+  }
+
+  // Builds the element in place through construct(Value*) only when no
+  // element with an equal key exists. A throwing construct leaves the
+  // elements unchanged. When the table has to grow, the element is built
+  // in the new slots while the old ones are still alive, so construct may
+  // read elements of this table.
+  template <class K, class F>
+  std::pair<iterator, bool> insert_with(const K& key, F&& construct) {
+    const std::size_t hash = hash_of(key);
+    if (std::size_t i = find_index(key, hash); i != capacity_)
+      return {iterator_at(i), false};
+    const std::size_t i = free_slot(hash);
+    if (i == capacity_) return {iterator_at(grow(hash, construct)), true};
+    construct(element_at(i));
+    commit(i, hash);
+    return {iterator_at(i), true};
+  }
+
+  template <class K>
+  iterator find(const K& key) {
+    return iterator_at(find_index(key, hash_of(key)));
+  }
+  template <class K>
+  const_iterator find(const K& key) const {
+    return const_cast<HashTable*>(this)->find(key);
+  }
+
+  // The mutable iterator to pos; slots are never const objects.
+  iterator mutable_iterator(const_iterator pos) noexcept {
+    return iterator(pos.ctrl_, const_cast<Slot*>(pos.slot_));
+  }
+
+  // Returns the element after the erased one.
+  iterator erase(const_iterator pos) {
+    const auto i = static_cast<std::size_t>(pos.ctrl_ - ctrl_);
+    erase_at(i);
+    iterator next = iterator_at(i);
+    next.skip_free();
+    return next;
+  }
+  template <class K>
+  size_type erase_key(const K& key) {
+    const std::size_t i = find_index(key, hash_of(key));
+    if (i == capacity_) return 0;
+    erase_at(i);
+    return 1;
+  }
+
+ private:
+  // Group-wise quadratic probing: the k-th group starts k(k + 1) / 2 groups
+  // after the first, which visits every group of a 2^k-slot table.
+  class Probe {
+   public:
+    Probe(std::size_t hash, std::size_t mask) noexcept
+        : mask_(mask), offset_((hash >> 7) & mask) {}
+    std::size_t offset() const noexcept { return offset_; }
+    std::size_t offset(std::size_t i) const noexcept {
+      return (offset_ + i) & mask_;
+    }
+    void next() noexcept {
+      index_ += kWidth;
+      offset_ = (offset_ + index_) & mask_;
+    }
+
+   private:
+    std::size_t mask_;
+    std::size_t offset_;
+    std::size_t index_ = 0;
+  };
+
+  // std::hash of an integer is often the integer itself; the multiply
+  // spreads it over the bits that pick the group and the control byte.
+  template <class K>
+  std::size_t hash_of(const K& key) const {
+    std::uint64_t x = hash_(key);
+    x ^= x >> 32;
+    x *= 0x9E3779B97F4A7C15ull;
+    x ^= x >> 32;
+    return static_cast<std::size_t>(x);
+  }
+  static std::int8_t h2(std::size_t hash) noexcept {
+    return static_cast<std::int8_t>(hash & 0x7F);
+  }
+
+  // Up to 7/8 of the slots are used, and at least one stays empty so that
+  // every probe ends.
+  static std::size_t growth_of(std::size_t capacity) noexcept {
+    return capacity ? std::min(capacity - 1, capacity - capacity / 8) : 0;
+  }
+  static std::size_t capacity_for(std::size_t n) noexcept {
+    return n + n / 7 + 1;
+  }
+  // The next 2^k - 1 of at least n and of at least one group.
+  static std::size_t normalize_capacity(std::size_t n) noexcept {
+    n = std::max(n, kCloned);
+    return std::numeric_limits<std::size_t>::max() >> std::countl_zero(n);
+  }
+
+  iterator iterator_at(std::size_t i) noexcept {
+    return iterator(ctrl_ + i, slots_ + i);
+  }
+  Value* element_at(std::size_t i) noexcept {
+    return Policy::element(slots_ + i);
+  }
+  const Value* element_at(std::size_t i) const noexcept {
+    return Policy::element(slots_ + i);
+  }
+
+  template <class K>
+  std::size_t find_index(const K& key, std::size_t hash) const {
+    Probe seq(hash, capacity_);
+    while (true) {
+      const hash_group g(ctrl_ + seq.offset());
+      for (auto m = g.match(h2(hash)); m; m.clear_lowest()) {
+        const std::size_t i = seq.offset(m.lowest());
+        if (eq_(KeyOfValue()(*element_at(i)), key)) return i;
+      }
+      if (g.match_empty()) return capacity_;
+      seq.next();
+    }
+  }
+
+  // The first empty or deleted slot on hash's probe sequence.
+  std::size_t find_first_free(std::size_t hash) const noexcept {
+    Probe seq(hash, capacity_);
+    while (true) {
+      const auto m = hash_group(ctrl_ + seq.offset()).match_empty_or_deleted();
+      if (m) return seq.offset(m.lowest());
+      seq.next();
+    }
+  }
+
+  // A slot for a new element with this hash, or capacity_ when the table
+  // must grow first. A reused deleted slot costs no growth.
+  std::size_t free_slot(std::size_t hash) const noexcept {
+    if (capacity_ == 0) return capacity_;
+    const std::size_t i = find_first_free(hash);
+    if (growth_left_ == 0 && ctrl_[i] != kHashDeleted) return capacity_;
+    return i;
+  }
+  void commit(std::size_t i, std::size_t hash) noexcept {
+    growth_left_ -= ctrl_[i] == kHashEmpty;
+    set_ctrl(i, h2(hash));
+    ++size_;
+  }
+
+  // Doubles the table, or rehashes at the same size when deleted slots
+  // rather than elements used up the growth, and places one new element.
+  template <class Place>
+  std::size_t grow(std::size_t hash, Place&& place) {
+    const std::size_t n = capacity_ > kWidth && size_ * 32 <= capacity_ * 25
+                              ? capacity_
+                              : (capacity_ ? capacity_ * 2 + 1 : kCloned);
+    return resize(n, hash, std::forward<Place>(place));
+  }
+
+  // Writes the control byte and its copy after the sentinel.
+  void set_ctrl(std::size_t i, std::int8_t h) noexcept {
+    ctrl_[i] = h;
+    ctrl_[((i - kCloned) & capacity_) + kCloned] = h;
+  }
+
+  // A slot becomes empty again only if no probe can have passed it while
+  // it was full: every window of kWidth slots around it has an empty slot.
+  void erase_at(std::size_t i) noexcept {
+    std::destroy_at(element_at(i));
+    --size_;
+    const auto after = hash_group(ctrl_ + i).match_empty();
+    const auto before =
+        hash_group(ctrl_ + ((i - kWidth) & capacity_)).match_empty();
+    const bool reusable =
+        after && before && after.lowest() + before.trailing_gap() < kWidth;
+    set_ctrl(i, reusable ? kHashEmpty : kHashDeleted);
+    growth_left_ += reusable;
+  }
+
+  // Rehashes into new_capacity slots. A non-null place(Value*) builds one
+  // new element with this hash in the new slots before the old elements
+  // leave theirs, and its index is returned; otherwise the result is
+  // capacity_. If anything throws, the table stays as it was.
+  template <class Place = std::nullptr_t>
+  std::size_t resize(std::size_t new_capacity, std::size_t hash = 0,
+                     Place&& place = nullptr) {
+    CtrlAlloc ctrl_alloc(alloc_);
+    SlotAlloc slot_alloc(alloc_);
+    std::int8_t* ctrl =
+        CtrlTraits::allocate(ctrl_alloc, new_capacity + 1 + kCloned);
+    Slot* slots;
+    try {
+      slots = SlotTraits::allocate(slot_alloc, new_capacity);
+    } catch (...) {
+      CtrlTraits::deallocate(ctrl_alloc, ctrl, new_capacity + 1 + kCloned);
+      throw;
+    }
+    reset_ctrl(ctrl, new_capacity);
+
+    std::int8_t* old_ctrl = std::exchange(ctrl_, ctrl);
+    Slot* old_slots = std::exchange(slots_, slots);
+    const std::size_t old_capacity = std::exchange(capacity_, new_capacity);
+    // Drops the new arrays and whatever was built in them.
+    auto undo = [&]() noexcept {
+      destroy_elements();
+      release(ctrl_, slots_, capacity_);
+      ctrl_ = old_ctrl;
+      slots_ = old_slots;
+      capacity_ = old_capacity;
+    };
+
+    std::size_t placed = new_capacity;
+    if constexpr (!std::is_null_pointer_v<std::remove_cvref_t<Place>>) {
+      placed = find_first_free(hash);
+      try {
+        place(element_at(placed));
+      } catch (...) {
+        undo();
+        throw;
+      }
+      set_ctrl(placed, h2(hash));
+    }
+
+    if constexpr (Policy::kNothrowTransfer ||
+                  !std::is_copy_constructible_v<Value>) {
+      for (std::size_t i = 0; i < old_capacity; ++i) {
+        if (old_ctrl[i] < 0) continue;
+        const std::size_t h =
+            hash_of(KeyOfValue()(*Policy::element(old_slots + i)));
+        const std::size_t j = find_first_free(h);
+        Policy::transfer(slots_ + j, old_slots + i);
+        set_ctrl(j, h2(h));
+      }
+    } else {
+      // Copies into the new slots first, so a throwing copy only has to
+      // undo the new table.
+      try {
+        for (std::size_t i = 0; i < old_capacity; ++i) {
+          if (old_ctrl[i] < 0) continue;
+          const Value& v = *Policy::element(old_slots + i);
+          const std::size_t h = hash_of(KeyOfValue()(v));
+          const std::size_t j = find_first_free(h);
+          std::construct_at(element_at(j), v);
+          set_ctrl(j, h2(h));
+        }
+      } catch (...) {
+        undo();
+        throw;
+      }
+      for (std::size_t i = 0; i < old_capacity; ++i)
+        if (old_ctrl[i] >= 0) std::destroy_at(Policy::element(old_slots + i));
+    }
+    size_ += placed != new_capacity;
+    growth_left_ = growth_of(new_capacity) - size_;
+    release(old_ctrl, old_slots, old_capacity);
+    return placed;
+  }
+
+  static void reset_ctrl(std::int8_t* ctrl, std::size_t capacity) noexcept {
+    std::memset(ctrl, static_cast<unsigned char>(kHashEmpty),
+                capacity + 1 + kCloned);
+    ctrl[capacity] = kHashSentinel;
+  }
+
+  void destroy_elements() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<Value>) {
+      for (std::size_t i = 0; i < capacity_; ++i)
+        if (ctrl_[i] >= 0) std::destroy_at(element_at(i));
+    }
+  }
+
+  void release(std::int8_t* ctrl, Slot* slots,
+               std::size_t capacity) noexcept {
+    if (capacity == 0) return;
+    CtrlAlloc ctrl_alloc(alloc_);
+    SlotAlloc slot_alloc(alloc_);
+    CtrlTraits::deallocate(ctrl_alloc, ctrl, capacity + 1 + kCloned);
+    SlotTraits::deallocate(slot_alloc, slots, capacity);
+  }
+};
+
+}  // namespace s21
@@ -1,6 +1,10 @@
 #pragma once
+#include <algorithm>
+#include <functional>
 #include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <memory>
 #include <stdexcept>
 #include <utility>
 #include <vector>
@@ -9,7 +13,11 @@
 
 namespace s21 {
 
-template <class Key, class T>
+// Ranked nodes also count their subtrees, which buys the order statistics
+// below at the price of a climb to the root on every insert and erase.
+template <class Key, class T, class Compare = std::less<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>,
+          bool Ranked = false>
 class map {
  public:
   using key_type = Key;
@@ -18,8 +26,12 @@ class map {
   using reference = value_type&;
   using const_reference = const value_type&;
   using size_type = std::size_t;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
 
-  using tree_type = RedBlackTree<Key, T>;
+  using tree_type =
+      RedBlackTree<Key, value_type, select_first, Compare, Allocator,
+                   Ranked>;
   using iterator = typename tree_type::iterator;
   using const_iterator = typename tree_type::const_iterator;
 
@@ -28,9 +40,30 @@ class map {
 
  public:
   map() = default;
+  explicit map(const Compare& comp, const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {}
+  explicit map(const Allocator& alloc) : tree_(Compare(), alloc) {}
+
+  map(std::initializer_list<value_type> items,
+      const Compare& comp = Compare(), const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    tree_.template assign_range<true>(items.begin(), items.end());
+  }
 
-  map(std::initializer_list<value_type> items) {
-    for (const auto& kv : items) insert(kv);
+  // Linear when [first, last) is already sorted by key, O(n log n)
+  // otherwise; of several equivalent keys the first one is kept.
+  template <std::input_iterator InputIt>
+  map(InputIt first, InputIt last, const Compare& comp = Compare(),
+      const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    tree_.template assign_range<true>(first, last);
+  }
+  // Always linear; [first, last) must be strictly ascending by key.
+  template <std::forward_iterator It>
+  map(sorted_unique_t, It first, It last, const Compare& comp = Compare(),
+      const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    tree_.assign_sorted(first, last);
   }
 
   map(const map&) = default;
@@ -50,17 +83,38 @@ class map {
   bool empty() const noexcept { return tree_.empty(); }
   size_type size() const noexcept { return tree_.size(); }
   size_type max_size() const noexcept {
-    return std::numeric_limits<size_type>::max() / sizeof(value_type);
+    return std::min<size_type>(
+        tree_type::max_size(),
+        std::numeric_limits<size_type>::max() / sizeof(value_type));
   }
 
   void clear() noexcept { tree_.clear(); }
 
+  template <std::input_iterator InputIt>
+  void assign(InputIt first, InputIt last) {
+    tree_.template assign_range<true>(first, last);
+  }
+  template <std::forward_iterator It>
+  void assign(sorted_unique_t, It first, It last) {
+    tree_.assign_sorted(first, last);
+  }
+
   std::pair<iterator, bool> insert(const value_type& value) {
     auto [node, inserted] = tree_.insert_unique(value);
     return {tree_.make_iterator(node), inserted};
   }
 
   std::pair<iterator, bool> insert(const key_type& key, const mapped_type& obj);
+  // Amortized O(1) when the element belongs right before hint, O(log n) in
+  // a ranked map.
+  iterator insert(const_iterator hint, const value_type& value) {
+    return tree_.make_iterator(tree_.insert_unique(hint, value).first);
+  }
+  template <class... Args>
+  iterator emplace_hint(const_iterator hint, Args&&... args) {
+    return tree_.make_iterator(
+        tree_.emplace_unique(hint, std::forward<Args>(args)...).first);
+  }
 
   std::pair<iterator, bool> insert_or_assign(const key_type& key,
                                              const mapped_type& obj);
@@ -80,10 +134,88 @@ class map {
   mapped_type& operator[](const key_type& key);
 
   iterator find(const key_type& key) { return tree_.find(key); }
-
   const_iterator find(const key_type& key) const { return tree_.find(key); }
+  template <class K>
+    requires transparent_compare<Compare>
+  iterator find(const K& key) {
+    return tree_.find(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  const_iterator find(const K& key) const {
+    return tree_.find(key);
+  }
 
   bool contains(const key_type& key) const;
+  template <class K>
+    requires transparent_compare<Compare>
+  bool contains(const K& key) const {
+    return tree_.find(key) != tree_.end();
+  }
+
+  size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+  template <class K>
+    requires transparent_compare<Compare>
+  size_type count(const K& key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  // Order statistics, ranked containers only, O(log n) each: the element
+  // at position k (end() when k >= size()), the number of elements ordered
+  // before key, and the number of elements with keys in [lo, hi).
+  iterator nth(size_type k)
+    requires Ranked
+  {
+    return tree_.make_iterator(tree_.nth_node(k));
+  }
+  const_iterator nth(size_type k) const
+    requires Ranked
+  {
+    return tree_.make_const_iterator(tree_.nth_node(k));
+  }
+  size_type rank(const key_type& key) const
+    requires Ranked
+  {
+    return tree_.rank(key);
+  }
+  size_type count_range(const key_type& lo, const key_type& hi) const
+    requires Ranked
+  {
+    return tree_.count_range(lo, hi);
+  }
+
+  iterator lower_bound(const key_type& key) { return tree_.lower_bound(key); }
+  const_iterator lower_bound(const key_type& key) const {
+    return tree_.lower_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  iterator lower_bound(const K& key) {
+    return tree_.lower_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  const_iterator lower_bound(const K& key) const {
+    return tree_.lower_bound(key);
+  }
+
+  iterator upper_bound(const key_type& key) { return tree_.upper_bound(key); }
+  const_iterator upper_bound(const key_type& key) const {
+    return tree_.upper_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  iterator upper_bound(const K& key) {
+    return tree_.upper_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  const_iterator upper_bound(const K& key) const {
+    return tree_.upper_bound(key);
+  }
+
+  key_compare key_comp() const { return tree_.key_comp(); }
+  allocator_type get_allocator() const { return tree_.get_allocator(); }
 
   template <class... Args>
   std::pair<iterator, bool> emplace(Args&&... args);
@@ -92,16 +224,18 @@ class map {
   std::vector<std::pair<iterator, bool>> insert_many(Args&&... args);
 };
 
-template <class Key, class T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
-    const key_type& key, const mapped_type& obj) {
+template <class Key, class T, class Compare, class Allocator, bool Ranked>
+std::pair<typename map<Key, T, Compare, Allocator, Ranked>::iterator, bool>
+map<Key, T, Compare, Allocator, Ranked>::insert(const key_type& key,
+                                                const mapped_type& obj) {
   value_type p{key, obj};
   auto [node, inserted] = tree_.insert_unique(p);
   return {tree_.make_iterator(node), inserted};
 }
 
-template <class Key, class T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert_or_assign(
+template <class Key, class T, class Compare, class Allocator, bool Ranked>
+std::pair<typename map<Key, T, Compare, Allocator, Ranked>::iterator, bool>
+map<Key, T, Compare, Allocator, Ranked>::insert_or_assign(
     const key_type& key, const mapped_type& obj) {
   auto it = tree_.find(key);
   if (it != tree_.end()) {
@@ -111,24 +245,25 @@ std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert_or_assign(
   return insert(value_type{key, obj});
 }
 
-template <class Key, class T>
-typename map<Key, T>::mapped_type& map<Key, T>::at(const key_type& key) {
+template <class Key, class T, class Compare, class Allocator, bool Ranked>
+typename map<Key, T, Compare, Allocator, Ranked>::mapped_type&
+map<Key, T, Compare, Allocator, Ranked>::at(const key_type& key) {
   auto it = tree_.find(key);
   if (it == tree_.end()) throw std::out_of_range("map::at: key not found");
   return (*it).second;
 }
 
-template <class Key, class T>
-const typename map<Key, T>::mapped_type& map<Key, T>::at(
-    const key_type& key) const {
+template <class Key, class T, class Compare, class Allocator, bool Ranked>
+const typename map<Key, T, Compare, Allocator, Ranked>::mapped_type&
+map<Key, T, Compare, Allocator, Ranked>::at(const key_type& key) const {
   auto it = tree_.find(key);
   if (it == tree_.end()) throw std::out_of_range("map::at: key not found");
   return (*it).second;
 }
 
-template <class Key, class T>
-typename map<Key, T>::mapped_type& map<Key, T>::operator[](
-    const key_type& key) {
+template <class Key, class T, class Compare, class Allocator, bool Ranked>
+typename map<Key, T, Compare, Allocator, Ranked>::mapped_type&
+map<Key, T, Compare, Allocator, Ranked>::operator[](const key_type& key) {
   auto it = tree_.find(key);
   if (it != tree_.end()) return (*it).second;
 
@@ -137,19 +272,20 @@ typename map<Key, T>::mapped_type& map<Key, T>::operator[](
   return (*it2).second;
 }
 
-template <class Key, class T>
-void map<Key, T>::erase(iterator pos) {
+template <class Key, class T, class Compare, class Allocator, bool Ranked>
+void map<Key, T, Compare, Allocator, Ranked>::erase(iterator pos) {
   if (pos == end()) return;
   tree_.erase(pos);
 }
 
-template <class Key, class T>
-bool map<Key, T>::contains(const key_type& key) const {
+template <class Key, class T, class Compare, class Allocator, bool Ranked>
+bool map<Key, T, Compare, Allocator, Ranked>::contains(
+    const key_type& key) const {
   return tree_.find(key) != tree_.end();
 }
 
-template <class Key, class T>
-void map<Key, T>::merge(map& other) {
+template <class Key, class T, class Compare, class Allocator, bool Ranked>
+void map<Key, T, Compare, Allocator, Ranked>::merge(map& other) {
   if (this == &other) return;
   std::vector<key_type> keys;
   keys.reserve(other.size());
@@ -164,22 +300,27 @@ void map<Key, T>::merge(map& other) {
   }
 }
 
-template <class Key, class T>
+template <class Key, class T, class Compare, class Allocator, bool Ranked>
 template <class... Args>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::emplace(
-    Args&&... args) {
+std::pair<typename map<Key, T, Compare, Allocator, Ranked>::iterator, bool>
+map<Key, T, Compare, Allocator, Ranked>::emplace(Args&&... args) {
   value_type v(std::forward<Args>(args)...);
   return insert(v);
 }
 
-template <class Key, class T>
+template <class Key, class T, class Compare, class Allocator, bool Ranked>
 template <class... Args>
-std::vector<std::pair<typename map<Key, T>::iterator, bool>>
-map<Key, T>::insert_many(Args&&... args) {
+std::vector<
+    std::pair<typename map<Key, T, Compare, Allocator, Ranked>::iterator, bool>>
+map<Key, T, Compare, Allocator, Ranked>::insert_many(Args&&... args) {
   std::vector<std::pair<iterator, bool>> res;
   res.reserve(sizeof...(args));
   (res.emplace_back(insert(std::forward<Args>(args))), ...);
   return res;
 }
 
+template <class Key, class T, class Compare = std::less<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>>
+using ranked_map = map<Key, T, Compare, Allocator, true>;
+
 }  // namespace s21
\ No newline at end of file
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <algorithm>
+#include <functional>
 #include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -10,7 +13,11 @@
 
 namespace s21 {
 
-template <class Key>
+// Ranked nodes also count their subtrees, which buys the order statistics
+// below and an O(log n) count() at the price of a climb to the root on
+// every insert and erase.
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>, bool Ranked = false>
 class multiset {
  public:
   using key_type = Key;
@@ -18,9 +25,13 @@ class multiset {
   using reference = value_type&;
   using const_reference = const value_type&;
   using size_type = std::size_t;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using allocator_type = Allocator;
 
  private:
-  using tree_type = RedBlackTree<Key, Key>;
+  using tree_type =
+      RedBlackTree<Key, const Key, identity_key, Compare, Allocator, Ranked>;
   tree_type tree_;
 
  public:
@@ -28,8 +39,30 @@ class multiset {
   using const_iterator = typename tree_type::const_iterator;
 
   multiset() = default;
-  multiset(std::initializer_list<value_type> items) {
-    for (const auto& key : items) insert(key);
+  explicit multiset(const Compare& comp, const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {}
+  explicit multiset(const Allocator& alloc) : tree_(Compare(), alloc) {}
+  multiset(std::initializer_list<value_type> items,
+           const Compare& comp = Compare(),
+           const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    tree_.template assign_range<false>(items.begin(), items.end());
+  }
+  // Linear when [first, last) is already sorted, O(n log n) otherwise;
+  // equivalent keys keep their input order.
+  template <std::input_iterator InputIt>
+  multiset(InputIt first, InputIt last, const Compare& comp = Compare(),
+           const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    tree_.template assign_range<false>(first, last);
+  }
+  // Always linear; [first, last) must be sorted.
+  template <std::forward_iterator It>
+  multiset(sorted_equivalent_t, It first, It last,
+           const Compare& comp = Compare(),
+           const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    tree_.assign_sorted(first, last);
   }
   multiset(const multiset&) = default;
   multiset(multiset&&) noexcept = default;
@@ -42,19 +75,42 @@ class multiset {
   const_iterator begin() const noexcept { return tree_.begin(); }
   iterator end() noexcept { return tree_.end(); }
   const_iterator end() const noexcept { return tree_.end(); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
 
   bool empty() const noexcept { return tree_.empty(); }
   size_type size() const noexcept { return tree_.size(); }
   size_type max_size() const noexcept {
-    return std::numeric_limits<size_type>::max() / sizeof(void*);
+    return std::min<size_type>(
+        tree_type::max_size(),
+        std::numeric_limits<size_type>::max() / sizeof(void*));
   }
 
   void clear() noexcept { tree_.clear(); }
 
+  template <std::input_iterator InputIt>
+  void assign(InputIt first, InputIt last) {
+    tree_.template assign_range<false>(first, last);
+  }
+  template <std::forward_iterator It>
+  void assign(sorted_equivalent_t, It first, It last) {
+    tree_.assign_sorted(first, last);
+  }
+
   iterator insert(const value_type& value) {
-    auto node = tree_.insert_equal({value, value});
+    auto node = tree_.insert_equal(value);
     return tree_.make_iterator(node);
   }
+  // Inserts as close before hint as the order allows; amortized O(1) when
+  // the element belongs right there, O(log n) in a ranked multiset.
+  iterator insert(const_iterator hint, const value_type& value) {
+    return tree_.make_iterator(tree_.insert_equal(hint, value));
+  }
+  template <class... Args>
+  iterator emplace_hint(const_iterator hint, Args&&... args) {
+    return tree_.make_iterator(
+        tree_.emplace_equal(hint, std::forward<Args>(args)...));
+  }
 
   iterator erase(iterator pos) {
     if (pos != end()) {
@@ -71,7 +127,7 @@ class multiset {
     std::vector<key_type> keys_to_move;
     keys_to_move.reserve(other.size());
     for (auto it = other.begin(); it != other.end(); ++it) {
-      keys_to_move.push_back((*it).first);
+      keys_to_move.push_back(*it);
     }
 
     for (const auto& key : keys_to_move) {
@@ -81,34 +137,88 @@ class multiset {
     other.clear();
   }
 
-  iterator find(const key_type& key) {
-    auto it = lower_bound(key);
-
-    if (it != end() && !((*it).first < key) && !(key < (*it).first)) return it;
-    return end();
-  }
+  iterator find(const key_type& key) { return find_impl(*this, key); }
   const_iterator find(const key_type& key) const {
-    auto it = lower_bound(key);
-    if (it != end() && !((*it).first < key) && !(key < (*it).first)) return it;
-    return end();
+    return find_impl(*this, key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  iterator find(const K& key) {
+    return find_impl(*this, key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  const_iterator find(const K& key) const {
+    return find_impl(*this, key);
   }
 
-  size_type count(const key_type& key) const {
-    auto range = equal_range(key);
-    return std::distance(range.first, range.second);
+  size_type count(const key_type& key) const { return tree_.count(key); }
+  template <class K>
+    requires transparent_compare<Compare>
+  size_type count(const K& key) const {
+    return tree_.count(key);
+  }
+
+  // Order statistics, ranked containers only, O(log n) each: the element
+  // at position k (end() when k >= size()), the number of elements ordered
+  // before key, and the number of elements with keys in [lo, hi).
+  iterator nth(size_type k)
+    requires Ranked
+  {
+    return tree_.make_iterator(tree_.nth_node(k));
+  }
+  const_iterator nth(size_type k) const
+    requires Ranked
+  {
+    return tree_.make_const_iterator(tree_.nth_node(k));
+  }
+  size_type rank(const key_type& key) const
+    requires Ranked
+  {
+    return tree_.rank(key);
+  }
+  size_type count_range(const key_type& lo, const key_type& hi) const
+    requires Ranked
+  {
+    return tree_.count_range(lo, hi);
   }
 
   bool contains(const key_type& key) const { return find(key) != end(); }
+  template <class K>
+    requires transparent_compare<Compare>
+  bool contains(const K& key) const {
+    return find(key) != end();
+  }
 
   iterator lower_bound(const key_type& key) { return tree_.lower_bound(key); }
   const_iterator lower_bound(const key_type& key) const {
     return tree_.lower_bound(key);
   }
+  template <class K>
+    requires transparent_compare<Compare>
+  iterator lower_bound(const K& key) {
+    return tree_.lower_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  const_iterator lower_bound(const K& key) const {
+    return tree_.lower_bound(key);
+  }
 
   iterator upper_bound(const key_type& key) { return tree_.upper_bound(key); }
   const_iterator upper_bound(const key_type& key) const {
     return tree_.upper_bound(key);
   }
+  template <class K>
+    requires transparent_compare<Compare>
+  iterator upper_bound(const K& key) {
+    return tree_.upper_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  const_iterator upper_bound(const K& key) const {
+    return tree_.upper_bound(key);
+  }
 
   std::pair<iterator, iterator> equal_range(const key_type& key) {
     return {lower_bound(key), upper_bound(key)};
@@ -117,6 +227,20 @@ class multiset {
       const key_type& key) const {
     return {lower_bound(key), upper_bound(key)};
   }
+  template <class K>
+    requires transparent_compare<Compare>
+  std::pair<iterator, iterator> equal_range(const K& key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  std::pair<const_iterator, const_iterator> equal_range(const K& key) const {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  key_compare key_comp() const { return tree_.key_comp(); }
+  value_compare value_comp() const { return tree_.key_comp(); }
+  allocator_type get_allocator() const { return tree_.get_allocator(); }
 
   template <class... Args>
   std::vector<iterator> insert_many(Args&&... args) {
@@ -126,6 +250,21 @@ class multiset {
     (result.push_back(insert(std::forward<Args>(args))), ...);
     return result;
   }
+
+ private:
+  // First element equivalent to key, shared by the const and non-const
+  // overloads.
+  template <class Self, class K>
+  static auto find_impl(Self& self, const K& key) {
+    auto it = self.lower_bound(key);
+    if (it != self.end() && !self.tree_.key_comp()(key, *it))
+      return it;
+    return self.end();
+  }
 };
 
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+using ranked_multiset = multiset<Key, Compare, Allocator, true>;
+
 }  // namespace s21
\ No newline at end of file
@@ -1,56 +1,163 @@
 #pragma once
+#include <algorithm>
+#include <bit>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
+#include <vector>
+
+#include "s21_slab_pool.h"
 
 namespace s21 {
 
 enum class Color { RED, BLACK };
 
-template <typename Key, typename T>
-struct Node {
-  using value_type = std::pair<const Key, T>;
+// Comparators such as std::less<> that accept any key-like operand; lookups
+// then take the argument as-is instead of converting it to Key first.
+template <class Compare>
+concept transparent_compare = requires { typename Compare::is_transparent; };
+
+// Key extraction policies: a set node stores the key itself, a map node
+// stores a pair ordered by its first member.
+struct identity_key {
+  template <class V>
+  constexpr const V& operator()(const V& v) const noexcept {
+    return v;
+  }
+};
+
+struct select_first {
+  template <class P>
+  constexpr const auto& operator()(const P& p) const noexcept {
+    return p.first;
+  }
+};
+
+// Tags for constructors and assign() whose input the caller guarantees to be
+// sorted by key: strictly ascending for sorted_unique, non-descending for
+// sorted_equivalent. The check that the untagged overloads run is skipped.
+struct sorted_unique_t {
+  explicit sorted_unique_t() = default;
+};
+inline constexpr sorted_unique_t sorted_unique{};
+
+struct sorted_equivalent_t {
+  explicit sorted_equivalent_t() = default;
+};
+inline constexpr sorted_equivalent_t sorted_equivalent{};
+
+// Nodes of a ranked tree carry the size of their subtree, this node
+// included; plain nodes carry nothing.
+template <bool Ranked>
+struct SubtreeCount {
+  std::uint32_t count{1};
+};
+template <>
+struct SubtreeCount<false> {};
+
+// The color lives in the low bit of the parent link, which is always zero
+// in a real node address. A ranked node's subtree count fills the padding
+// next to keys of four bytes or less.
+template <typename Value, bool Ranked = false>
+struct Node : SubtreeCount<Ranked> {
+  using value_type = Value;
 
   value_type data{};
-  Color color{Color::RED};
-  Node* parent{nullptr};
   Node* left{nullptr};
   Node* right{nullptr};
 
+  Node* parent() const noexcept {
+    return reinterpret_cast<Node*>(parent_color_ & ~kBlackBit);
+  }
+  void set_parent(Node* p) noexcept {
+    parent_color_ =
+        reinterpret_cast<std::uintptr_t>(p) | (parent_color_ & kBlackBit);
+  }
+  Color color() const noexcept {
+    return (parent_color_ & kBlackBit) ? Color::BLACK : Color::RED;
+  }
+  void set_color(Color c) noexcept {
+    parent_color_ = (parent_color_ & ~kBlackBit) |
+                    (c == Color::BLACK ? kBlackBit : std::uintptr_t{0});
+  }
+
   Node() = default;
   explicit Node(const value_type& v) : data(v) {}
-  explicit Node(value_type&& v) noexcept : data(std::move(v)) {}
+  explicit Node(value_type&& v) noexcept(
+      std::is_nothrow_constructible_v<value_type, value_type&&>)
+      : data(std::move(v)) {}
+  template <class... Args>
+  explicit Node(std::in_place_t, Args&&... args)
+      : data(std::forward<Args>(args)...) {}
+
+ private:
+  static constexpr std::uintptr_t kBlackBit = 1;
+  static_assert(alignof(Node*) > kBlackBit, "no spare bit in node pointers");
+
+  // Parent address | kBlackBit when black; zero is a red root-less node.
+  std::uintptr_t parent_color_ = 0;
 };
 
-template <typename Key, typename T>
+// Nodes come from a per-tree slab_pool that takes its chunks from
+// Allocator, so inserts and erases recycle slots instead of calling the
+// global allocator, and clear() hands all chunks back at once.
+//
+// Value is what a node stores and iterators expose; KeyOfValue maps it to
+// the Key that Compare orders. A const Value makes every iterator constant,
+// which is how sets keep their elements immutable.
+//
+// A Ranked tree also counts every node's subtree, kept up to date by
+// link_node, erase and the rotations, so positional queries (nth, rank,
+// iterator jumps) take O(log n) instead of a walk. The price is a climb to
+// the root on every insert and erase, hinted ones included, so plain trees
+// leave it out.
+template <typename Key, typename Value, typename KeyOfValue,
+          typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::remove_const_t<Value>>,
+          bool Ranked = false>
 class RedBlackTree {
  private:
-  using Node_t = Node<Key, T>;
+  using Node_t = Node<Value, Ranked>;
+  using NodeAlloc =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node_t>;
+  using NodeTraits = std::allocator_traits<NodeAlloc>;
 
+  slab_pool<Node_t, NodeAlloc> pool_;
   Node_t* header_ = nullptr;
   std::size_t size_ = 0;
   Node_t* min_node_ = nullptr;
   Node_t* max_node_ = nullptr;
+  [[no_unique_address]] Compare comp_;
 
  public:
   using value_type = typename Node_t::value_type;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
 
-  RedBlackTree() {
-    header_ = new Node_t{};
-    header_->color = Color::BLACK;
-    header_->parent = nullptr;
-    header_->left = header_;
-    header_->right = header_;
-  }
+  RedBlackTree() : RedBlackTree(Compare()) {}
+
+  explicit RedBlackTree(const Compare& comp,
+                        const Allocator& alloc = Allocator())
+      : pool_(NodeAlloc(alloc)), header_(make_header()), comp_(comp) {}
 
-  RedBlackTree(const RedBlackTree& other) : RedBlackTree() {
+  RedBlackTree(const RedBlackTree& other)
+      : RedBlackTree(other.comp_,
+                     std::allocator_traits<Allocator>::
+                         select_on_container_copy_construction(
+                             other.get_allocator())) {
     Node_t* new_root = nullptr;
 
     if (other.size_ > 0) {
-      new_root = copy_helper(other.header_->parent, header_);
+      new_root = copy_helper(other.header_->parent(), header_);
     }
 
-    header_->parent = new_root;
+    header_->set_parent(new_root);
     size_ = other.size_;
 
     if (size_ > 0) {
@@ -63,22 +170,20 @@ class RedBlackTree {
   }
 
   RedBlackTree(RedBlackTree&& other) noexcept
-      : header_(other.header_),
+      : pool_(std::move(other.pool_)),
+        header_(other.header_),
         size_(other.size_),
         min_node_(other.min_node_),
-        max_node_(other.max_node_) {
-    other.header_ = new Node_t{};
-    other.header_->color = Color::BLACK;
-    other.header_->parent = nullptr;
-    other.header_->left = other.header_;
-    other.header_->right = other.header_;
+        max_node_(other.max_node_),
+        comp_(other.comp_) {
+    other.header_ = other.make_header();
 
     other.size_ = 0;
     other.min_node_ = other.header_;
     other.max_node_ = other.header_;
 
-    if (header_->parent != nullptr) {
-      header_->parent->parent = header_;
+    if (header_->parent() != nullptr) {
+      header_->parent()->set_parent(header_);
     }
   }
 
@@ -100,56 +205,27 @@ class RedBlackTree {
 
   ~RedBlackTree() {
     clear();
-    delete header_;
+    drop_header(header_);
   }
 
-  std::pair<Node_t*, bool> insert_unique(
-      const typename Node_t::value_type& val) {
-    const Key& key = val.first;
-
-    Node_t* cur = header_->parent;
-    Node_t* par = header_;
-
-    while (cur != nullptr) {
-      par = cur;
-      const Key& ck = cur->data.first;
-      if (key < ck)
-        cur = cur->left;
-      else if (ck < key)
-        cur = cur->right;
-      else
-        return {cur, false};
-    }
-
-    Node_t* new_node = new Node_t(val);
-
-    Node_t* result = attach_node(new_node, par);
-
-    ++size_;
-    insert_rebalance(result);
-    update_min_max_nodes(result);
-    return {result, true};
+  std::pair<Node_t*, bool> insert_unique(const value_type& val) {
+    const InsertPos pos = unique_pos(KeyOfValue()(val));
+    if (pos.existing) return {pos.existing, false};
+    return {link_node(create_node(val), pos), true};
   }
 
   Node_t* insert_equal(const value_type& value) {
-    Node_t* parent = find_insertion_point_equal(value.first);
-
-    Node_t* new_node = new Node_t(value);
-
-    Node_t* result = attach_node(new_node, parent);
-
-    insert_rebalance(result);
-
-    update_min_max_nodes(result);
-
-    size_++;
-
-    return result;
+    return link_node(create_node(value),
+                     equal_pos(KeyOfValue()(value)));
   }
 
   void clear() noexcept {
-    clear_helper(header_->parent);
-    header_->parent = nullptr;
+    // Trivially destructible nodes need no walk: dropping the chunks is
+    // the whole teardown.
+    if constexpr (!std::is_trivially_destructible_v<Node_t>)
+      clear_helper(header_->parent());
+    pool_.release();
+    header_->set_parent(nullptr);
     min_node_ = nullptr;
     max_node_ = nullptr;
     size_ = 0;
@@ -160,57 +236,76 @@ class RedBlackTree {
   void erase(Node_t* z) {
     if (!z || z == header_) return;
 
+    // The extremes move to the erased node's neighbour; nodes are relinked
+    // rather than copied below, so these pointers stay valid.
+    Node_t* new_min = min_node_;
+    Node_t* new_max = max_node_;
+    if (size_ == 1) {
+      new_min = new_max = nullptr;
+    } else {
+      if (z == min_node_) new_min = next_node(z);
+      if (z == max_node_) new_max = prev_node(z);
+    }
+
+    // The node that physically leaves its position is z itself or, with
+    // two children, its successor; each of its ancestors loses one.
+    if constexpr (Ranked) {
+      Node_t* gone = (z->left && z->right) ? find_min(z->right) : z;
+      for (Node_t* p = gone->parent(); p != header_; p = p->parent())
+        --p->count;
+    }
+
     Node_t* x = nullptr;
     Node_t* x_parent = nullptr;
     Node_t* y = z;
-    Color y_color = y->color;
+    Color y_color = y->color();
 
     if (z->left == nullptr) {
       x = z->right;
-      x_parent = z->parent;
+      x_parent = z->parent();
       transplant(z, z->right);
-      if (x) x_parent = x->parent;
+      if (x) x_parent = x->parent();
     } else if (z->right == nullptr) {
       x = z->left;
-      x_parent = z->parent;
+      x_parent = z->parent();
       transplant(z, z->left);
-      if (x) x_parent = x->parent;
+      if (x) x_parent = x->parent();
     } else {
       y = z->right;
       while (y->left) y = y->left;
-      y_color = y->color;
+      y_color = y->color();
       x = y->right;
 
-      if (y->parent != z) {
-        x_parent = y->parent;
+      if (y->parent() != z) {
+        x_parent = y->parent();
         transplant(y, y->right);
-        if (y->right) y->right->parent = y;
         y->right = z->right;
-        y->right->parent = y;
+        y->right->set_parent(y);
       } else {
         x_parent = y;
-        if (x) x->parent = y;
+        if (x) x->set_parent(y);
       }
 
       transplant(z, y);
       y->left = z->left;
-      y->left->parent = y;
-      y->color = z->color;
+      y->left->set_parent(y);
+      y->set_color(z->color());
+      if constexpr (Ranked) y->count = z->count;
     }
 
-    delete z;
+    destroy_node(z);
     --size_;
 
     if (y_color == Color::BLACK) erase_rebalance(x, x_parent);
 
-    update_min_max_nodes_after_erase();
+    set_extremes(new_min, new_max);
   }
 
   class MapIterator {
    private:
     Node_t* current_ = nullptr;
     Node_t* header_ptr_ = nullptr;
-    friend class RedBlackTree<Key, T>;
+    friend class RedBlackTree;
 
    public:
     using difference_type = std::ptrdiff_t;
@@ -238,10 +333,12 @@ class RedBlackTree {
         current_ = current_->right;
         while (current_->left) current_ = current_->left;
       } else {
-        Node_t* p = current_->parent;
-        while (p && current_ == p->right) {
+        Node_t* p = current_->parent();
+        // Stop at the header: the root's parent, whose right link points
+        // back at the maximum.
+        while (p != header_ptr_ && current_ == p->right) {
           current_ = p;
-          p = p->parent;
+          p = p->parent();
         }
         current_ = p;
       }
@@ -262,10 +359,10 @@ class RedBlackTree {
         current_ = current_->left;
         while (current_->right) current_ = current_->right;
       } else {
-        Node_t* p = current_->parent;
+        Node_t* p = current_->parent();
         while (p && current_ == p->left) {
           current_ = p;
-          p = p->parent;
+          p = p->parent();
         }
         current_ = p;
       }
@@ -277,13 +374,47 @@ class RedBlackTree {
       --(*this);
       return t;
     }
+
+    // Ranked trees only: jumps by rank through the subtree sizes, O(log n)
+    // for any distance.
+    MapIterator& operator+=(difference_type d)
+      requires Ranked
+    {
+      const auto r =
+          static_cast<difference_type>(rank_of(current_, header_ptr_));
+      current_ = select_node(header_ptr_, static_cast<std::size_t>(r + d));
+      return *this;
+    }
+    MapIterator& operator-=(difference_type d)
+      requires Ranked
+    {
+      return *this += -d;
+    }
+    MapIterator operator+(difference_type d) const
+      requires Ranked
+    {
+      MapIterator t(*this);
+      return t += d;
+    }
+    MapIterator operator-(difference_type d) const
+      requires Ranked
+    {
+      MapIterator t(*this);
+      return t += -d;
+    }
+    difference_type operator-(const MapIterator& o) const
+      requires Ranked
+    {
+      return static_cast<difference_type>(rank_of(current_, header_ptr_)) -
+             static_cast<difference_type>(rank_of(o.current_, o.header_ptr_));
+    }
   };
 
   class ConstMapIterator {
    private:
     const Node_t* current_ = nullptr;
     const Node_t* header_ptr_ = nullptr;
-    friend class RedBlackTree<Key, T>;
+    friend class RedBlackTree;
 
    public:
     using difference_type = std::ptrdiff_t;
@@ -295,6 +426,8 @@ class RedBlackTree {
     ConstMapIterator() = default;
     ConstMapIterator(const Node_t* n, const Node_t* h)
         : current_(n), header_ptr_(h) {}
+    ConstMapIterator(const MapIterator& it)
+        : current_(it.current_), header_ptr_(it.header_ptr_) {}
 
     reference operator*() const { return current_->data; }
     pointer operator->() const { return &current_->data; }
@@ -312,10 +445,10 @@ class RedBlackTree {
         current_ = current_->right;
         while (current_->left) current_ = current_->left;
       } else {
-        const Node_t* p = current_->parent;
-        while (p && current_ == p->right) {
+        const Node_t* p = current_->parent();
+        while (p != header_ptr_ && current_ == p->right) {
           current_ = p;
-          p = p->parent;
+          p = p->parent();
         }
         current_ = p;
       }
@@ -336,10 +469,10 @@ class RedBlackTree {
         current_ = current_->left;
         while (current_->right) current_ = current_->right;
       } else {
-        const Node_t* p = current_->parent;
+        const Node_t* p = current_->parent();
         while (p && current_ == p->left) {
           current_ = p;
-          p = p->parent;
+          p = p->parent();
         }
         current_ = p;
       }
@@ -350,11 +483,123 @@ class RedBlackTree {
       --(*this);
       return t;
     }
+
+    // Ranked trees only: jumps by rank through the subtree sizes, O(log n)
+    // for any distance.
+    ConstMapIterator& operator+=(difference_type d)
+      requires Ranked
+    {
+      const auto r =
+          static_cast<difference_type>(rank_of(current_, header_ptr_));
+      current_ = select_node(header_ptr_, static_cast<std::size_t>(r + d));
+      return *this;
+    }
+    ConstMapIterator& operator-=(difference_type d)
+      requires Ranked
+    {
+      return *this += -d;
+    }
+    ConstMapIterator operator+(difference_type d) const
+      requires Ranked
+    {
+      ConstMapIterator t(*this);
+      return t += d;
+    }
+    ConstMapIterator operator-(difference_type d) const
+      requires Ranked
+    {
+      ConstMapIterator t(*this);
+      return t += -d;
+    }
+    difference_type operator-(const ConstMapIterator& o) const
+      requires Ranked
+    {
+      return static_cast<difference_type>(rank_of(current_, header_ptr_)) -
+             static_cast<difference_type>(rank_of(o.current_, o.header_ptr_));
+    }
   };
 
   using iterator = MapIterator;
   using const_iterator = ConstMapIterator;
 
+  // Hinted forms: when the new key belongs right before hint (or at the
+  // end for end()), the node is linked next to it without a descent from
+  // the root, so feeding sorted input with end() as the hint costs
+  // amortized O(1) per element; a ranked tree still climbs to the root to
+  // update the counts, which makes it O(log n). A wrong hint falls back to
+  // a full search.
+  std::pair<Node_t*, bool> insert_unique(const_iterator hint,
+                                         const value_type& val) {
+    const InsertPos pos = unique_pos(hint.current_, KeyOfValue()(val));
+    if (pos.existing) return {pos.existing, false};
+    return {link_node(create_node(val), pos), true};
+  }
+
+  Node_t* insert_equal(const_iterator hint, const value_type& value) {
+    return link_node(create_node(value),
+                     equal_pos(hint.current_, KeyOfValue()(value)));
+  }
+
+  // The value is built first, since only then is its key known; a
+  // duplicate is destroyed again.
+  template <class... Args>
+  std::pair<Node_t*, bool> emplace_unique(const_iterator hint,
+                                          Args&&... args) {
+    Node_t* n = create_node(std::in_place, std::forward<Args>(args)...);
+    const InsertPos pos = unique_pos(hint.current_, key_of(n));
+    if (pos.existing) {
+      destroy_node(n);
+      return {pos.existing, false};
+    }
+    return {link_node(n, pos), true};
+  }
+
+  template <class... Args>
+  Node_t* emplace_equal(const_iterator hint, Args&&... args) {
+    Node_t* n = create_node(std::in_place, std::forward<Args>(args)...);
+    return link_node(n, equal_pos(hint.current_, key_of(n)));
+  }
+
+  // Bulk load: replaces the contents with a perfectly balanced tree built
+  // in one linear pass, with no comparisons and no rebalancing. Input that
+  // is already sorted (strictly, when Unique) is detected and used as-is;
+  // anything else is ordered through a buffer of pointers first, and for
+  // unique trees the first of each run of equivalent keys wins, exactly as
+  // with repeated insertion. Gives the strong exception guarantee.
+  template <bool Unique, std::input_iterator It>
+  void assign_range(It first, It last) {
+    using Stored = std::remove_const_t<Value>;
+    using Ref = std::iter_reference_t<It>;
+    RedBlackTree tmp(comp_, get_allocator());
+    if constexpr (std::forward_iterator<It> &&
+                  std::is_lvalue_reference_v<Ref> &&
+                  std::is_same_v<std::remove_cvref_t<Ref>, Stored>) {
+      tmp.template build_ordered<Unique>(
+          first, last, [](const Stored& v) -> const Stored& { return v; });
+    } else {
+      // Single-pass or converting input is materialized once, so keys are
+      // compared as Key and the buffered values can be moved into nodes.
+      std::vector<Stored> buf(first, last);
+      tmp.template build_ordered<Unique>(
+          buf.begin(), buf.end(),
+          [](Stored& v) -> Stored&& { return std::move(v); });
+    }
+    swap(tmp);
+  }
+
+  // As assign_range, for input the caller guarantees is sorted (and free of
+  // duplicates when the tree is unique).
+  template <std::forward_iterator It>
+  void assign_sorted(It first, It last) {
+    RedBlackTree tmp(comp_, get_allocator());
+    tmp.build_balanced(first,
+                       static_cast<std::size_t>(std::distance(first, last)),
+                       [](auto&& v) -> decltype(auto) {
+                         return std::forward<decltype(v)>(v);
+                       });
+    swap(tmp);
+  }
+
   iterator begin() {
     return (size_ == 0) ? iterator(header_, header_)
                         : iterator(min_node_, header_);
@@ -367,11 +612,13 @@ class RedBlackTree {
   }
   const_iterator end() const { return const_iterator(header_, header_); }
 
-  iterator find(const Key& key) {
+  template <class K>
+  iterator find(const K& key) {
     Node_t* n = find_node(key);
     return n ? iterator(n, header_) : end();
   }
-  const_iterator find(const Key& key) const {
+  template <class K>
+  const_iterator find(const K& key) const {
     Node_t* n = find_node(key);
     return n ? const_iterator(n, header_) : end();
   }
@@ -381,66 +628,86 @@ class RedBlackTree {
     return const_iterator(n, header_);
   }
 
-  iterator lower_bound(const Key& key) {
-    Node_t* current = header_->parent;
-    Node_t* result = header_;
-
-    while (current) {
-      if (!(current->data.first < key)) {
-        result = current;
-        current = current->left;
-      } else {
-        current = current->right;
-      }
-    }
-    return iterator(result, header_);
+  template <class K>
+  iterator lower_bound(const K& key) {
+    return iterator(lower_bound_node(key), header_);
+  }
+  template <class K>
+  const_iterator lower_bound(const K& key) const {
+    return const_iterator(lower_bound_node(key), header_);
   }
 
-  iterator upper_bound(const Key& key) {
-    Node_t* current = header_->parent;
-    Node_t* result = header_;
+  template <class K>
+  iterator upper_bound(const K& key) {
+    return iterator(upper_bound_node(key), header_);
+  }
+  template <class K>
+  const_iterator upper_bound(const K& key) const {
+    return const_iterator(upper_bound_node(key), header_);
+  }
 
-    while (current) {
-      if (key < current->data.first) {
-        result = current;
-        current = current->left;
+  // Order statistics, ranked trees only. rank is the number of elements
+  // ordered before key, upper_rank the number not ordered after it.
+  template <class K>
+  std::size_t rank(const K& key) const
+    requires Ranked
+  {
+    std::size_t r = 0;
+    for (Node_t* cur = header_->parent(); cur;) {
+      if (comp_(key_of(cur), key)) {
+        r += subtree_count(cur->left) + 1;
+        cur = cur->right;
       } else {
-        current = current->right;
+        cur = cur->left;
       }
     }
-    return iterator(result, header_);
+    return r;
   }
-
-  const_iterator lower_bound(const Key& key) const {
-    Node_t* current = header_->parent;
-    Node_t* result = header_;
-
-    while (current) {
-      if (!(current->data.first < key)) {
-        result = current;
-        current = current->left;
+  template <class K>
+  std::size_t upper_rank(const K& key) const
+    requires Ranked
+  {
+    std::size_t r = 0;
+    for (Node_t* cur = header_->parent(); cur;) {
+      if (!comp_(key, key_of(cur))) {
+        r += subtree_count(cur->left) + 1;
+        cur = cur->right;
       } else {
-        current = current->right;
+        cur = cur->left;
       }
     }
-    return const_iterator(result, header_);
+    return r;
   }
 
-  const_iterator upper_bound(const Key& key) const {
-    Node_t* current = header_->parent;
-    Node_t* result = header_;
+  // A plain tree walks the run of equal keys.
+  template <class K>
+  std::size_t count(const K& key) const {
+    if constexpr (Ranked)
+      return upper_rank(key) - rank(key);
+    else
+      return static_cast<std::size_t>(
+          std::distance(lower_bound(key), upper_bound(key)));
+  }
 
-    while (current) {
-      if (key < current->data.first) {
-        result = current;
-        current = current->left;
-      } else {
-        current = current->right;
-      }
-    }
-    return const_iterator(result, header_);
+  // Keys in [lo, hi).
+  template <class K>
+  std::size_t count_range(const K& lo, const K& hi) const
+    requires Ranked
+  {
+    const std::size_t a = rank(lo);
+    const std::size_t b = rank(hi);
+    return b > a ? b - a : 0;
   }
 
+  // The element at in-order position k, or the header past the end.
+  Node_t* nth_node(std::size_t k) const noexcept
+    requires Ranked
+  {
+    return select_node(header_, k);
+  }
+
+  const Compare& key_comp() const noexcept { return comp_; }
+
   iterator erase(iterator pos) noexcept {
     if (pos == end()) {
       return end();
@@ -457,117 +724,195 @@ class RedBlackTree {
   }
 
   void swap(RedBlackTree& other) noexcept {
+    using std::swap;
+    pool_.swap(other.pool_);
+    swap(comp_, other.comp_);
     std::swap(header_, other.header_);
     std::swap(size_, other.size_);
     std::swap(min_node_, other.min_node_);
     std::swap(max_node_, other.max_node_);
 
-    if (header_->parent) {
-      header_->parent->parent = header_;
+    if (header_->parent()) {
+      header_->parent()->set_parent(header_);
     }
 
-    if (other.header_->parent) {
-      other.header_->parent->parent = other.header_;
+    if (other.header_->parent()) {
+      other.header_->parent()->set_parent(other.header_);
     }
   }
 
   std::size_t size() const noexcept { return size_; }
   bool empty() const noexcept { return size_ == 0; }
+  // A ranked tree is bounded by the width of its subtree counts.
+  static constexpr std::size_t max_size() noexcept {
+    if constexpr (Ranked)
+      return std::numeric_limits<std::uint32_t>::max();
+    else
+      return std::numeric_limits<std::size_t>::max();
+  }
+
+  allocator_type get_allocator() const {
+    return allocator_type(pool_.get_allocator());
+  }
+
+  // Checks ordering between neighbours, parent links, colors, black heights,
+  // subtree counts when ranked, size and the cached extremes. For tests and
+  // debugging; O(n).
+  bool verify() const {
+    Node_t* root = header_->parent();
+    if (!root)
+      return size_ == 0 && header_->left == header_ &&
+             header_->right == header_;
+    if (root->parent() != header_ || root->color() != Color::BLACK)
+      return false;
+    std::size_t count = 0;
+    if (black_height(root, count) < 0 || count != size_) return false;
+    return min_node_ == find_min(root) && max_node_ == find_max(root) &&
+           header_->left == min_node_ && header_->right == max_node_;
+  }
 
  private:
+  // The header outlives clear(), so it is allocated outside the pool.
+  Node_t* make_header() {
+    NodeAlloc alloc = pool_.get_allocator();
+    Node_t* h = NodeTraits::allocate(alloc, 1);
+    try {
+      ::new (static_cast<void*>(h)) Node_t();
+    } catch (...) {
+      NodeTraits::deallocate(alloc, h, 1);
+      throw;
+    }
+    h->set_color(Color::BLACK);
+    h->left = h;
+    h->right = h;
+    return h;
+  }
+  void drop_header(Node_t* h) noexcept {
+    NodeAlloc alloc = pool_.get_allocator();
+    std::destroy_at(h);
+    NodeTraits::deallocate(alloc, h, 1);
+  }
+
+  template <class... Args>
+  Node_t* create_node(Args&&... args) {
+    if constexpr (Ranked)
+      if (size_ == max_size())
+        throw std::length_error("s21::RedBlackTree: too many elements");
+    Node_t* n = pool_.allocate();
+    try {
+      ::new (static_cast<void*>(n)) Node_t(std::forward<Args>(args)...);
+    } catch (...) {
+      pool_.deallocate(n);
+      throw;
+    }
+    return n;
+  }
+  void destroy_node(Node_t* n) noexcept {
+    std::destroy_at(n);
+    pool_.deallocate(n);
+  }
+
   void rotate_left(Node_t* x) {
     Node_t* y = x->right;
     x->right = y->left;
-    if (y->left) y->left->parent = x;
+    if (y->left) y->left->set_parent(x);
 
-    y->parent = x->parent;
-    if (x->parent == header_)
-      header_->parent = y;
-    else if (x == x->parent->left)
-      x->parent->left = y;
+    y->set_parent(x->parent());
+    if (x->parent() == header_)
+      header_->set_parent(y);
+    else if (x == x->parent()->left)
+      x->parent()->left = y;
     else
-      x->parent->right = y;
+      x->parent()->right = y;
 
     y->left = x;
-    x->parent = y;
+    x->set_parent(y);
+    if constexpr (Ranked) {
+      y->count = x->count;
+      x->count = recount(x);
+    }
   }
 
   void rotate_right(Node_t* y) {
     Node_t* x = y->left;
     y->left = x->right;
-    if (x->right) x->right->parent = y;
+    if (x->right) x->right->set_parent(y);
 
-    x->parent = y->parent;
-    if (y->parent == header_)
-      header_->parent = x;
-    else if (y == y->parent->right)
-      y->parent->right = x;
+    x->set_parent(y->parent());
+    if (y->parent() == header_)
+      header_->set_parent(x);
+    else if (y == y->parent()->right)
+      y->parent()->right = x;
     else
-      y->parent->left = x;
+      y->parent()->left = x;
 
     x->right = y;
-    y->parent = x;
+    y->set_parent(x);
+    if constexpr (Ranked) {
+      x->count = y->count;
+      y->count = recount(y);
+    }
   }
 
   void insert_rebalance(Node_t* z) {
-    while (z != header_->parent && z->parent->color == Color::RED) {
-      Node_t* p = z->parent;
-      Node_t* g = p->parent;
+    while (z != header_->parent() && z->parent()->color() == Color::RED) {
+      Node_t* p = z->parent();
+      Node_t* g = p->parent();
       if (p == g->left) {
         Node_t* u = g->right;
-        if (u && u->color == Color::RED) {
-          p->color = Color::BLACK;
-          u->color = Color::BLACK;
-          if (g != header_->parent) g->color = Color::RED;
+        if (u && u->color() == Color::RED) {
+          p->set_color(Color::BLACK);
+          u->set_color(Color::BLACK);
+          if (g != header_->parent()) g->set_color(Color::RED);
           z = g;
         } else {
           if (z == p->right) {
             rotate_left(p);
             z = z->left;
-            p = z->parent;
+            p = z->parent();
           }
-          p->color = Color::BLACK;
-          g->color = Color::RED;
+          p->set_color(Color::BLACK);
+          g->set_color(Color::RED);
           rotate_right(g);
           break;
         }
       } else {
         Node_t* u = g->left;
-        if (u && u->color == Color::RED) {
-          p->color = Color::BLACK;
-          u->color = Color::BLACK;
-          if (g != header_->parent) g->color = Color::RED;
+        if (u && u->color() == Color::RED) {
+          p->set_color(Color::BLACK);
+          u->set_color(Color::BLACK);
+          if (g != header_->parent()) g->set_color(Color::RED);
           z = g;
         } else {
           if (z == p->left) {
             rotate_right(p);
             z = z->right;
-            p = z->parent;
+            p = z->parent();
           }
-          p->color = Color::BLACK;
-          g->color = Color::RED;
+          p->set_color(Color::BLACK);
+          g->set_color(Color::RED);
           rotate_left(g);
           break;
         }
       }
     }
-    if (header_->parent) header_->parent->color = Color::BLACK;
+    if (header_->parent()) header_->parent()->set_color(Color::BLACK);
   }
 
   void transplant(Node_t* u, Node_t* v) {
-    if (u->parent == header_)
-      header_->parent = v;
-    else if (u == u->parent->left)
-      u->parent->left = v;
+    if (u->parent() == header_)
+      header_->set_parent(v);
+    else if (u == u->parent()->left)
+      u->parent()->left = v;
     else
-      u->parent->right = v;
-    if (v) v->parent = u->parent;
+      u->parent()->right = v;
+    if (v) v->set_parent(u->parent());
   }
 
   void erase_rebalance(Node_t* x, Node_t* parent) {
-    while ((x != header_->parent) &&
-           (x == nullptr || x->color == Color::BLACK)) {
-      Node_t* p = x ? x->parent : parent;
+    while ((x != header_->parent()) &&
+           (x == nullptr || x->color() == Color::BLACK)) {
+      Node_t* p = x ? x->parent() : parent;
       if (!p) break;
 
       bool x_is_left = (x == p->left);
@@ -575,9 +920,9 @@ class RedBlackTree {
 
       Node_t* w = x_is_left ? p->right : p->left;
 
-      if (w && w->color == Color::RED) {
-        w->color = Color::BLACK;
-        p->color = Color::RED;
+      if (w && w->color() == Color::RED) {
+        w->set_color(Color::BLACK);
+        p->set_color(Color::RED);
         if (x_is_left)
           rotate_left(p);
         else
@@ -587,76 +932,115 @@ class RedBlackTree {
 
       Node_t* wl = w ? w->left : nullptr;
       Node_t* wr = w ? w->right : nullptr;
-      bool wl_black = (!wl || wl->color == Color::BLACK);
-      bool wr_black = (!wr || wr->color == Color::BLACK);
+      bool wl_black = (!wl || wl->color() == Color::BLACK);
+      bool wr_black = (!wr || wr->color() == Color::BLACK);
 
       if (wl_black && wr_black) {
-        if (w) w->color = Color::RED;
+        if (w) w->set_color(Color::RED);
         x = p;
-        parent = x->parent;
+        parent = x->parent();
       } else {
         if (x_is_left) {
           if (wr_black) {
-            if (wl) wl->color = Color::BLACK;
-            if (w) w->color = Color::RED;
+            if (wl) wl->set_color(Color::BLACK);
+            if (w) w->set_color(Color::RED);
             rotate_right(w);
             w = p->right;
             wr = w ? w->right : nullptr;
           }
-          if (w) w->color = p->color;
-          p->color = Color::BLACK;
-          if (wr) wr->color = Color::BLACK;
+          if (w) w->set_color(p->color());
+          p->set_color(Color::BLACK);
+          if (wr) wr->set_color(Color::BLACK);
           rotate_left(p);
         } else {
           if (wl_black) {
-            if (wr) wr->color = Color::BLACK;
-            if (w) w->color = Color::RED;
+            if (wr) wr->set_color(Color::BLACK);
+            if (w) w->set_color(Color::RED);
             rotate_left(w);
             w = p->left;
             wl = w ? w->left : nullptr;
           }
-          if (w) w->color = p->color;
-          p->color = Color::BLACK;
-          if (wl) wl->color = Color::BLACK;
+          if (w) w->set_color(p->color());
+          p->set_color(Color::BLACK);
+          if (wl) wl->set_color(Color::BLACK);
           rotate_right(p);
         }
-        x = header_->parent;
+        x = header_->parent();
       }
     }
-    if (x) x->color = Color::BLACK;
+    if (x) x->set_color(Color::BLACK);
   }
 
-  void update_min_max_nodes(Node_t* n) {
-    if (!min_node_ || n->data.first < min_node_->data.first) {
-      min_node_ = n;
-      header_->left = min_node_;
+  void set_extremes(Node_t* min, Node_t* max) noexcept {
+    min_node_ = min;
+    max_node_ = max;
+    header_->left = min ? min : header_;
+    header_->right = max ? max : header_;
+  }
+
+  // In-order neighbours of a node that has one; unlike the iterators these
+  // never step onto the header.
+  static Node_t* next_node(Node_t* n) noexcept {
+    if (n->right) return find_min(n->right);
+    Node_t* p = n->parent();
+    while (n == p->right) {
+      n = p;
+      p = p->parent();
     }
-    if (!max_node_ || max_node_->data.first < n->data.first) {
-      max_node_ = n;
-      header_->right = max_node_;
+    return p;
+  }
+  static Node_t* prev_node(Node_t* n) noexcept {
+    if (n->left) return find_max(n->left);
+    Node_t* p = n->parent();
+    while (n == p->left) {
+      n = p;
+      p = p->parent();
     }
+    return p;
   }
 
-  void update_min_max_nodes_after_erase() {
-    Node_t* root = header_->parent;
-    if (!root) {
-      min_node_ = nullptr;
-      max_node_ = nullptr;
-      header_->left = header_;
-      header_->right = header_;
-    } else {
-      min_node_ = find_min(root);
-      max_node_ = find_max(root);
-      header_->left = min_node_;
-      header_->right = max_node_;
+  static std::size_t subtree_count(const Node_t* n) noexcept {
+    return n ? n->count : 0;
+  }
+  static std::uint32_t recount(const Node_t* n) noexcept {
+    return static_cast<std::uint32_t>(subtree_count(n->left) +
+                                      subtree_count(n->right) + 1);
+  }
+
+  // In-order position of n; the header ranks after the last element.
+  static std::size_t rank_of(const Node_t* n, const Node_t* header) noexcept {
+    if (n == header) return subtree_count(header->parent());
+    std::size_t r = subtree_count(n->left);
+    for (const Node_t* p = n->parent(); p != header; n = p, p = p->parent())
+      if (n == p->right) r += subtree_count(p->left) + 1;
+    return r;
+  }
+
+  static Node_t* select_node(const Node_t* header, std::size_t k) noexcept {
+    Node_t* n = header->parent();
+    if (k >= subtree_count(n)) return const_cast<Node_t*>(header);
+    for (;;) {
+      const std::size_t left = subtree_count(n->left);
+      if (k < left) {
+        n = n->left;
+      } else if (k == left) {
+        return n;
+      } else {
+        k -= left + 1;
+        n = n->right;
+      }
     }
   }
 
-  static void clear_helper(Node_t* node) {
+  static const Key& key_of(const Node_t* n) noexcept {
+    return KeyOfValue()(n->data);
+  }
+
+  void clear_helper(Node_t* node) noexcept {
     if (!node) return;
     clear_helper(node->left);
     clear_helper(node->right);
-    delete node;
+    std::destroy_at(node);
   }
 
   static Node_t* find_min(Node_t* n) {
@@ -668,13 +1052,14 @@ class RedBlackTree {
     return n;
   }
 
-  Node_t* find_node(const Key& key) const {
-    Node_t* cur = header_->parent;
+  template <class K>
+  Node_t* find_node(const K& key) const {
+    Node_t* cur = header_->parent();
     while (cur) {
-      const Key& ck = cur->data.first;
-      if (key < ck)
+      const Key& ck = key_of(cur);
+      if (comp_(key, ck))
         cur = cur->left;
-      else if (ck < key)
+      else if (comp_(ck, key))
         cur = cur->right;
       else
         return cur;
@@ -682,46 +1067,261 @@ class RedBlackTree {
     return nullptr;
   }
 
-  static Node_t* copy_helper(const Node_t* other, Node_t* parent) {
+  template <class K>
+  Node_t* lower_bound_node(const K& key) const {
+    Node_t* current = header_->parent();
+    Node_t* result = header_;
+    while (current) {
+      if (!comp_(key_of(current), key)) {
+        result = current;
+        current = current->left;
+      } else {
+        current = current->right;
+      }
+    }
+    return result;
+  }
+
+  template <class K>
+  Node_t* upper_bound_node(const K& key) const {
+    Node_t* current = header_->parent();
+    Node_t* result = header_;
+    while (current) {
+      if (comp_(key, key_of(current))) {
+        result = current;
+        current = current->left;
+      } else {
+        current = current->right;
+      }
+    }
+    return result;
+  }
+
+  Node_t* copy_helper(const Node_t* other, Node_t* parent) {
     if (!other) return nullptr;
-    Node_t* n = new Node_t(other->data);
-    n->color = other->color;
-    n->parent = parent;
+    Node_t* n = create_node(other->data);
+    n->set_color(other->color());
+    if constexpr (Ranked) n->count = other->count;
+    n->set_parent(parent);
     n->left = copy_helper(other->left, n);
     n->right = copy_helper(other->right, n);
     return n;
   }
 
-  Node_t* find_insertion_point_equal(const Key& key) const {
-    Node_t* current = header_->parent;
-    Node_t* parent = header_;
+  // Returns the black height of the subtree at n, or -1 if it breaks an
+  // invariant; count accumulates the number of nodes visited.
+  int black_height(const Node_t* n, std::size_t& count) const {
+    if (!n) return 1;
+    ++count;
+    for (const Node_t* child : {n->left, n->right}) {
+      if (!child) continue;
+      if (child->parent() != n) return -1;
+      if (n->color() == Color::RED && child->color() == Color::RED) return -1;
+    }
+    if (n->left && comp_(key_of(n), key_of(n->left))) return -1;
+    if (n->right && comp_(key_of(n->right), key_of(n))) return -1;
+    if constexpr (Ranked)
+      if (n->count != recount(n)) return -1;
+    const int lh = black_height(n->left, count);
+    const int rh = black_height(n->right, count);
+    if (lh < 0 || lh != rh) return -1;
+    return lh + (n->color() == Color::BLACK ? 1 : 0);
+  }
 
-    while (current) {
-      parent = current;
-      const Key& current_key = current->data.first;
+  template <bool Unique, class It>
+  bool is_ordered(It first, It last) const {
+    if (first == last) return true;
+    for (It next = std::next(first); next != last; first = next++) {
+      const auto& a = KeyOfValue()(*first);
+      const auto& b = KeyOfValue()(*next);
+      if (Unique ? !comp_(a, b) : comp_(b, a)) return false;
+    }
+    return true;
+  }
 
-      if (key < current_key) {
-        current = current->left;
+  // Fills an empty tree from [first, last), sorting pointers to the
+  // elements when the range is out of order. proj turns an element into
+  // the constructor argument for its node.
+  template <bool Unique, class It, class Proj>
+  void build_ordered(It first, It last, Proj proj) {
+    const auto n = static_cast<std::size_t>(std::distance(first, last));
+    if (is_ordered<Unique>(first, last)) {
+      build_balanced(first, n, proj);
+      return;
+    }
+    using Ptr = decltype(std::addressof(*first));
+    std::vector<Ptr> order;
+    order.reserve(n);
+    for (; first != last; ++first) order.push_back(std::addressof(*first));
+    std::stable_sort(order.begin(), order.end(), [this](Ptr a, Ptr b) {
+      return comp_(KeyOfValue()(*a), KeyOfValue()(*b));
+    });
+    if constexpr (Unique) {
+      order.erase(std::unique(order.begin(), order.end(),
+                              [this](Ptr a, Ptr b) {
+                                return !comp_(KeyOfValue()(*a),
+                                              KeyOfValue()(*b));
+                              }),
+                  order.end());
+    }
+    build_balanced(order.begin(), order.size(),
+                   [&proj](Ptr p) -> decltype(auto) { return proj(*p); });
+  }
+
+  // Links n values taken in order from first into an empty tree. Splitting
+  // every range at its middle leaves all null links on the two deepest
+  // levels, so coloring the deepest level of nodes red and the rest black
+  // gives every path the same black height without a single rotation.
+  template <class It, class Proj>
+  void build_balanced(It first, std::size_t n, Proj proj) {
+    if (n == 0) return;
+    if constexpr (Ranked)
+      if (n > max_size())
+        throw std::length_error("s21::RedBlackTree: too many elements");
+    const std::size_t red_depth = std::bit_width(n) - 1;
+    Node_t* root = build_subtree(first, n, 0, red_depth, proj);
+    root->set_parent(header_);
+    root->set_color(Color::BLACK);
+    header_->set_parent(root);
+    size_ = n;
+    set_extremes(find_min(root), find_max(root));
+  }
+
+  template <class It, class Proj>
+  Node_t* build_subtree(It& first, std::size_t n, std::size_t depth,
+                        std::size_t red_depth, Proj& proj) {
+    if (n == 0) return nullptr;
+    const std::size_t left_n = (n - 1) / 2;
+    Node_t* left = build_subtree(first, left_n, depth + 1, red_depth, proj);
+    Node_t* node = nullptr;
+    try {
+      node = create_node(std::in_place, proj(*first));
+    } catch (...) {
+      clear_helper(left);
+      throw;
+    }
+    ++first;
+    node->left = left;
+    if (left) left->set_parent(node);
+    try {
+      node->right =
+          build_subtree(first, n - 1 - left_n, depth + 1, red_depth, proj);
+    } catch (...) {
+      clear_helper(node);
+      throw;
+    }
+    if (node->right) node->right->set_parent(node);
+    node->set_color(depth == red_depth ? Color::RED : Color::BLACK);
+    if constexpr (Ranked) node->count = static_cast<std::uint32_t>(n);
+    return node;
+  }
+
+  // Where a new node goes: as the left or right child of parent, unless
+  // existing already holds an equivalent key (unique insertion only).
+  struct InsertPos {
+    Node_t* parent;
+    bool left;
+    Node_t* existing;
+  };
+
+  InsertPos unique_pos(const Key& key) const {
+    Node_t* cur = header_->parent();
+    Node_t* par = header_;
+    bool left = true;
+    while (cur) {
+      par = cur;
+      const Key& ck = key_of(cur);
+      if (comp_(key, ck)) {
+        left = true;
+        cur = cur->left;
+      } else if (comp_(ck, key)) {
+        left = false;
+        cur = cur->right;
       } else {
-        current = current->right;
+        return {nullptr, false, cur};
       }
     }
-    return parent;
+    return {par, left, nullptr};
   }
 
-  Node_t* attach_node(Node_t* new_node, Node_t* parent) {
-    const Key& key = new_node->data.first;
-    new_node->parent = parent;
+  // Equal keys go after their equivalents, so duplicates keep insertion
+  // order.
+  InsertPos equal_pos(const Key& key) const {
+    Node_t* cur = header_->parent();
+    Node_t* par = header_;
+    bool left = true;
+    while (cur) {
+      par = cur;
+      left = comp_(key, key_of(cur));
+      cur = left ? cur->left : cur->right;
+    }
+    return {par, left, nullptr};
+  }
 
+  InsertPos unique_pos(const Node_t* hint, const Key& key) const {
+    Node_t* pos = const_cast<Node_t*>(hint);
+    if (pos == header_) {
+      if (size_ > 0 && comp_(key_of(max_node_), key))
+        return {max_node_, false, nullptr};
+      return unique_pos(key);
+    }
+    if (comp_(key, key_of(pos))) {
+      if (pos == min_node_) return {pos, true, nullptr};
+      Node_t* before = prev_node(pos);
+      if (!comp_(key_of(before), key)) return unique_pos(key);
+      // Adjacent nodes: one of the two facing child links is free.
+      return before->right ? InsertPos{pos, true, nullptr}
+                           : InsertPos{before, false, nullptr};
+    }
+    if (comp_(key_of(pos), key)) {
+      if (pos == max_node_) return {pos, false, nullptr};
+      Node_t* after = next_node(pos);
+      if (!comp_(key, key_of(after))) return unique_pos(key);
+      return pos->right ? InsertPos{after, true, nullptr}
+                        : InsertPos{pos, false, nullptr};
+    }
+    return {nullptr, false, pos};
+  }
+
+  InsertPos equal_pos(const Node_t* hint, const Key& key) const {
+    Node_t* pos = const_cast<Node_t*>(hint);
+    if (pos == header_) {
+      if (size_ > 0 && !comp_(key, key_of(max_node_)))
+        return {max_node_, false, nullptr};
+      return equal_pos(key);
+    }
+    if (!comp_(key_of(pos), key)) {
+      if (pos == min_node_) return {pos, true, nullptr};
+      Node_t* before = prev_node(pos);
+      if (comp_(key, key_of(before))) return equal_pos(key);
+      return before->right ? InsertPos{pos, true, nullptr}
+                           : InsertPos{before, false, nullptr};
+    }
+    if (pos == max_node_) return {pos, false, nullptr};
+    Node_t* after = next_node(pos);
+    if (comp_(key_of(after), key)) return equal_pos(key);
+    return pos->right ? InsertPos{after, true, nullptr}
+                      : InsertPos{pos, false, nullptr};
+  }
+
+  Node_t* link_node(Node_t* n, const InsertPos& pos) noexcept {
+    Node_t* parent = pos.parent;
+    n->set_parent(parent);
     if (parent == header_) {
-      header_->parent = new_node;
-    } else if (key < parent->data.first) {
-      parent->left = new_node;
+      header_->set_parent(n);
+      set_extremes(n, n);
+    } else if (pos.left) {
+      parent->left = n;
+      if (parent == min_node_) set_extremes(n, max_node_);
     } else {
-      parent->right = new_node;
+      parent->right = n;
+      if (parent == max_node_) set_extremes(min_node_, n);
     }
-
-    return new_node;
+    ++size_;
+    if constexpr (Ranked)
+      for (Node_t* p = parent; p != header_; p = p->parent()) ++p->count;
+    insert_rebalance(n);
+    return n;
   }
 };
 
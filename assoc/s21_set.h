@@ -1,6 +1,10 @@
 #pragma once
+#include <algorithm>
+#include <functional>
 #include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -8,7 +12,10 @@
 
 namespace s21 {
 
-template <class Key>
+// Ranked nodes also count their subtrees, which buys the order statistics
+// below at the price of a climb to the root on every insert and erase.
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>, bool Ranked = false>
 class set {
  public:
   using key_type = Key;
@@ -16,8 +23,13 @@ class set {
   using reference = value_type&;
   using const_reference = const value_type&;
   using size_type = std::size_t;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using allocator_type = Allocator;
 
-  using tree_type = RedBlackTree<Key, Key>;
+  // Nodes hold a single const Key, so both iterator types are constant.
+  using tree_type =
+      RedBlackTree<Key, const Key, identity_key, Compare, Allocator, Ranked>;
   using iterator = typename tree_type::iterator;
   using const_iterator = typename tree_type::const_iterator;
 
@@ -26,9 +38,31 @@ class set {
 
  public:
   set() = default;
+  explicit set(const Compare& comp, const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {}
+  explicit set(const Allocator& alloc) : tree_(Compare(), alloc) {}
+
+  set(std::initializer_list<value_type> items,
+      const Compare& comp = Compare(),
+      const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    tree_.template assign_range<true>(items.begin(), items.end());
+  }
 
-  set(std::initializer_list<value_type> items) {
-    for (const auto& key : items) insert(key);
+  // Linear when [first, last) is already sorted, O(n log n) otherwise; of
+  // several equivalent keys the first one is kept.
+  template <std::input_iterator InputIt>
+  set(InputIt first, InputIt last, const Compare& comp = Compare(),
+      const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    tree_.template assign_range<true>(first, last);
+  }
+  // Always linear; [first, last) must be strictly ascending.
+  template <std::forward_iterator It>
+  set(sorted_unique_t, It first, It last, const Compare& comp = Compare(),
+      const Allocator& alloc = Allocator())
+      : tree_(comp, alloc) {
+    tree_.assign_sorted(first, last);
   }
 
   set(const set&) = default;
@@ -47,15 +81,36 @@ class set {
   bool empty() const noexcept { return tree_.empty(); }
   size_type size() const noexcept { return tree_.size(); }
   size_type max_size() const noexcept {
-    return std::numeric_limits<size_type>::max() / sizeof(value_type);
+    return std::min<size_type>(
+        tree_type::max_size(),
+        std::numeric_limits<size_type>::max() / sizeof(value_type));
   }
 
   void clear() noexcept { tree_.clear(); }
 
+  template <std::input_iterator InputIt>
+  void assign(InputIt first, InputIt last) {
+    tree_.template assign_range<true>(first, last);
+  }
+  template <std::forward_iterator It>
+  void assign(sorted_unique_t, It first, It last) {
+    tree_.assign_sorted(first, last);
+  }
+
   std::pair<iterator, bool> insert(const value_type& value) {
-    auto [node, inserted] = tree_.insert_unique({value, value});
+    auto [node, inserted] = tree_.insert_unique(value);
     return {tree_.make_iterator(node), inserted};
   }
+  // Amortized O(1) when the element belongs right before hint, O(log n) in
+  // a ranked set.
+  iterator insert(const_iterator hint, const value_type& value) {
+    return tree_.make_iterator(tree_.insert_unique(hint, value).first);
+  }
+  template <class... Args>
+  iterator emplace_hint(const_iterator hint, Args&&... args) {
+    return tree_.make_iterator(
+        tree_.emplace_unique(hint, std::forward<Args>(args)...).first);
+  }
 
   void erase(iterator pos) {
     if (pos == end()) return;
@@ -72,7 +127,7 @@ class set {
     for (auto it = other.begin(); it != other.end();) {
       auto next = it;
       ++next;
-      auto [pos, inserted] = insert((*it).first);
+      auto [pos, inserted] = insert(*it);
       if (inserted) other.erase(it);
       it = next;
     }
@@ -88,9 +143,90 @@ class set {
     return it;
   }
 
+  template <class K>
+    requires transparent_compare<Compare>
+  iterator find(const K& key) {
+    return tree_.find(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  const_iterator find(const K& key) const {
+    return tree_.find(key);
+  }
+
   bool contains(const key_type& key) const {
     return tree_.find(key) != tree_.end();
   }
+  template <class K>
+    requires transparent_compare<Compare>
+  bool contains(const K& key) const {
+    return tree_.find(key) != tree_.end();
+  }
+
+  size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+  template <class K>
+    requires transparent_compare<Compare>
+  size_type count(const K& key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  // Order statistics, ranked containers only, O(log n) each: the element
+  // at position k (end() when k >= size()), the number of elements ordered
+  // before key, and the number of elements with keys in [lo, hi).
+  iterator nth(size_type k)
+    requires Ranked
+  {
+    return tree_.make_iterator(tree_.nth_node(k));
+  }
+  const_iterator nth(size_type k) const
+    requires Ranked
+  {
+    return tree_.make_const_iterator(tree_.nth_node(k));
+  }
+  size_type rank(const key_type& key) const
+    requires Ranked
+  {
+    return tree_.rank(key);
+  }
+  size_type count_range(const key_type& lo, const key_type& hi) const
+    requires Ranked
+  {
+    return tree_.count_range(lo, hi);
+  }
+
+  iterator lower_bound(const key_type& key) { return tree_.lower_bound(key); }
+  const_iterator lower_bound(const key_type& key) const {
+    return tree_.lower_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  iterator lower_bound(const K& key) {
+    return tree_.lower_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  const_iterator lower_bound(const K& key) const {
+    return tree_.lower_bound(key);
+  }
+
+  iterator upper_bound(const key_type& key) { return tree_.upper_bound(key); }
+  const_iterator upper_bound(const key_type& key) const {
+    return tree_.upper_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  iterator upper_bound(const K& key) {
+    return tree_.upper_bound(key);
+  }
+  template <class K>
+    requires transparent_compare<Compare>
+  const_iterator upper_bound(const K& key) const {
+    return tree_.upper_bound(key);
+  }
+
+  key_compare key_comp() const { return tree_.key_comp(); }
+  value_compare value_comp() const { return tree_.key_comp(); }
+  allocator_type get_allocator() const { return tree_.get_allocator(); }
 
   template <class... Args>
   std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
@@ -101,4 +237,8 @@ class set {
   }
 };
 
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+using ranked_set = set<Key, Compare, Allocator, true>;
+
 }  // namespace s21
\ No newline at end of file
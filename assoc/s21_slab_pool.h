@@ -0,0 +1,132 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace s21 {
+
+// Fixed-size object pool for node-based containers. Slots are carved from
+// chunks obtained through Allocator, chunk sizes double from kFirstChunk up
+// to kMaxChunk slots, and freed slots go onto an intrusive free list that
+// allocate() drains first. Nothing is returned to Allocator until release()
+// or destruction, which frees every chunk at once, so the caller must have
+// destroyed the objects living in the pool by then.
+template <class T, class Allocator = std::allocator<T>>
+class slab_pool {
+  union Slot {
+    Slot* next;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  struct Chunk {
+    Chunk* next;
+    Slot* slots;
+    std::size_t count;
+  };
+
+  using AllocTraits = std::allocator_traits<Allocator>;
+  using SlotAlloc = typename AllocTraits::template rebind_alloc<Slot>;
+  using SlotTraits = std::allocator_traits<SlotAlloc>;
+  using ChunkAlloc = typename AllocTraits::template rebind_alloc<Chunk>;
+  using ChunkTraits = std::allocator_traits<ChunkAlloc>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+
+  static constexpr size_type kFirstChunk = 16;
+  static constexpr size_type kMaxChunk = 4096;
+
+  slab_pool() = default;
+  explicit slab_pool(const Allocator& alloc) : alloc_(alloc) {}
+  slab_pool(const slab_pool&) = delete;
+  slab_pool& operator=(const slab_pool&) = delete;
+  slab_pool(slab_pool&& other) noexcept
+      : alloc_(std::move(other.alloc_)),
+        chunks_(std::exchange(other.chunks_, nullptr)),
+        free_(std::exchange(other.free_, nullptr)),
+        cursor_(std::exchange(other.cursor_, nullptr)),
+        end_(std::exchange(other.end_, nullptr)),
+        next_chunk_(std::exchange(other.next_chunk_, kFirstChunk)) {}
+  slab_pool& operator=(slab_pool&& other) noexcept {
+    if (this != &other) {
+      slab_pool tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+  ~slab_pool() { release(); }
+
+  // Uninitialized storage for one T.
+  [[nodiscard]] T* allocate() {
+    if (free_) {
+      Slot* slot = free_;
+      free_ = slot->next;
+      return reinterpret_cast<T*>(slot->storage);
+    }
+    if (cursor_ == end_) grow();
+    return reinterpret_cast<T*>((cursor_++)->storage);
+  }
+
+  void deallocate(T* p) noexcept {
+    Slot* slot = reinterpret_cast<Slot*>(p);
+    slot->next = free_;
+    free_ = slot;
+  }
+
+  // Returns every chunk to the allocator; all slots become invalid.
+  void release() noexcept {
+    SlotAlloc slot_alloc(alloc_);
+    ChunkAlloc chunk_alloc(alloc_);
+    while (chunks_) {
+      Chunk* next = chunks_->next;
+      SlotTraits::deallocate(slot_alloc, chunks_->slots, chunks_->count);
+      ChunkTraits::deallocate(chunk_alloc, chunks_, 1);
+      chunks_ = next;
+    }
+    free_ = cursor_ = end_ = nullptr;
+    next_chunk_ = kFirstChunk;
+  }
+
+  void swap(slab_pool& other) noexcept {
+    using std::swap;
+    swap(alloc_, other.alloc_);
+    swap(chunks_, other.chunks_);
+    swap(free_, other.free_);
+    swap(cursor_, other.cursor_);
+    swap(end_, other.end_);
+    swap(next_chunk_, other.next_chunk_);
+  }
+
+  allocator_type get_allocator() const { return alloc_; }
+
+ private:
+  void grow() {
+    SlotAlloc slot_alloc(alloc_);
+    ChunkAlloc chunk_alloc(alloc_);
+    Chunk* chunk = ChunkTraits::allocate(chunk_alloc, 1);
+    try {
+      chunk->slots = SlotTraits::allocate(slot_alloc, next_chunk_);
+    } catch (...) {
+      ChunkTraits::deallocate(chunk_alloc, chunk, 1);
+      throw;
+    }
+    chunk->count = next_chunk_;
+    chunk->next = chunks_;
+    chunks_ = chunk;
+    cursor_ = chunk->slots;
+    end_ = chunk->slots + chunk->count;
+    if (next_chunk_ < kMaxChunk) next_chunk_ *= 2;
+  }
+
+  [[no_unique_address]] Allocator alloc_;
+  Chunk* chunks_ = nullptr;
+  Slot* free_ = nullptr;
+  Slot* cursor_ = nullptr;
+  Slot* end_ = nullptr;
+  size_type next_chunk_ = kFirstChunk;
+};
+
+}  // namespace s21
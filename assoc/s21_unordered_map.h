@@ -0,0 +1,216 @@
+#pragma once
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+
+// Hash map on an open-addressing Swiss table with the s21::map method set
+// for point lookups: average O(1) find, insert and erase, no ordering.
+// Inserting past the load limit rehashes and invalidates iterators;
+// reserve() ahead of a batch of insertions avoids that.
+template <class Key, class T, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>>
+class unordered_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+
+  using table_type =
+      HashTable<Key, value_type, select_first, Hash, KeyEqual, Allocator>;
+  using iterator = typename table_type::iterator;
+  using const_iterator = typename table_type::const_iterator;
+
+ private:
+  table_type table_;
+
+ public:
+  unordered_map() = default;
+  explicit unordered_map(size_type bucket_count, const Hash& hash = Hash(),
+                         const KeyEqual& eq = KeyEqual(),
+                         const Allocator& alloc = Allocator())
+      : table_(bucket_count, hash, eq, alloc) {}
+  explicit unordered_map(const Allocator& alloc)
+      : table_(0, Hash(), KeyEqual(), alloc) {}
+
+  unordered_map(std::initializer_list<value_type> items,
+                size_type bucket_count = 0, const Hash& hash = Hash(),
+                const KeyEqual& eq = KeyEqual(),
+                const Allocator& alloc = Allocator())
+      : unordered_map(items.begin(), items.end(), bucket_count, hash, eq,
+                      alloc) {}
+
+  // Of several equal keys the first one is kept.
+  template <std::input_iterator InputIt>
+  unordered_map(InputIt first, InputIt last, size_type bucket_count = 0,
+                const Hash& hash = Hash(), const KeyEqual& eq = KeyEqual(),
+                const Allocator& alloc = Allocator())
+      : table_(bucket_count, hash, eq, alloc) {
+    if constexpr (std::forward_iterator<InputIt>)
+      reserve(static_cast<size_type>(std::distance(first, last)));
+    for (; first != last; ++first) insert(*first);
+  }
+
+  unordered_map(const unordered_map&) = default;
+  unordered_map(unordered_map&&) noexcept = default;
+  ~unordered_map() = default;
+  unordered_map& operator=(const unordered_map&) = default;
+  unordered_map& operator=(unordered_map&&) noexcept = default;
+
+  iterator begin() noexcept { return table_.begin(); }
+  const_iterator begin() const noexcept { return table_.begin(); }
+  iterator end() noexcept { return table_.end(); }
+  const_iterator end() const noexcept { return table_.end(); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return table_.empty(); }
+  size_type size() const noexcept { return table_.size(); }
+  size_type max_size() const noexcept { return table_type::max_size(); }
+
+  void clear() noexcept { table_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return table_.insert_with(value.first, [&](value_type* slot) {
+      std::construct_at(slot, value);
+    });
+  }
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return table_.insert_with(value.first, [&](value_type* slot) {
+      std::construct_at(slot, std::move(value));
+    });
+  }
+  std::pair<iterator, bool> insert(const key_type& key,
+                                   const mapped_type& obj) {
+    return try_emplace(key, obj);
+  }
+  std::pair<iterator, bool> insert_or_assign(const key_type& key,
+                                             const mapped_type& obj) {
+    auto res = try_emplace(key, obj);
+    if (!res.second) res.first->second = obj;
+    return res;
+  }
+  // The mapped value is built from args only when key is new.
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+    return table_.insert_with(key, [&](value_type* slot) {
+      std::construct_at(slot, std::piecewise_construct,
+                        std::forward_as_tuple(key),
+                        std::forward_as_tuple(std::forward<Args>(args)...));
+    });
+  }
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return insert(value_type(std::forward<Args>(args)...));
+  }
+
+  // Returns the element that followed pos; other iterators stay valid.
+  iterator erase(const_iterator pos) { return table_.erase(pos); }
+  size_type erase(const key_type& key) { return table_.erase_key(key); }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual> &&
+             (!std::is_convertible_v<const K&, const_iterator>)
+  size_type erase(const K& key) {
+    return table_.erase_key(key);
+  }
+
+  void swap(unordered_map& other) noexcept { table_.swap(other.table_); }
+
+  // Moves in every element whose key is not present yet; the rest stay in
+  // other.
+  void merge(unordered_map& other) {
+    if (this == &other) return;
+    for (auto it = other.begin(); it != other.end();) {
+      if (insert(std::move(*it)).second)
+        it = other.erase(it);
+      else
+        ++it;
+    }
+  }
+
+  mapped_type& at(const key_type& key) {
+    auto it = find(key);
+    if (it == end())
+      throw std::out_of_range("unordered_map::at: key not found");
+    return it->second;
+  }
+  const mapped_type& at(const key_type& key) const {
+    auto it = find(key);
+    if (it == end())
+      throw std::out_of_range("unordered_map::at: key not found");
+    return it->second;
+  }
+  mapped_type& operator[](const key_type& key) {
+    return try_emplace(key).first->second;
+  }
+
+  iterator find(const key_type& key) { return table_.find(key); }
+  const_iterator find(const key_type& key) const { return table_.find(key); }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual>
+  iterator find(const K& key) {
+    return table_.find(key);
+  }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual>
+  const_iterator find(const K& key) const {
+    return table_.find(key);
+  }
+
+  bool contains(const key_type& key) const { return find(key) != end(); }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual>
+  bool contains(const K& key) const {
+    return find(key) != end();
+  }
+
+  size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual>
+  size_type count(const K& key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  // Room for n elements without a rehash.
+  void reserve(size_type n) { table_.reserve(n); }
+  // At least n slots, and no tombstones left by erase.
+  void rehash(size_type n) { table_.rehash(n); }
+  size_type bucket_count() const noexcept { return table_.capacity(); }
+  float load_factor() const noexcept { return table_.load_factor(); }
+  float max_load_factor() const noexcept {
+    return table_type::max_load_factor();
+  }
+
+  hasher hash_function() const { return table_.hash_function(); }
+  key_equal key_eq() const { return table_.key_eq(); }
+  allocator_type get_allocator() const { return table_.get_allocator(); }
+
+  // Reserves room for every argument first, so no insertion rehashes and
+  // all returned iterators stay valid.
+  template <class... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    reserve(size() + sizeof...(args));
+    std::vector<std::pair<iterator, bool>> res;
+    res.reserve(sizeof...(args));
+    (res.push_back(insert(value_type(std::forward<Args>(args)))), ...);
+    return res;
+  }
+};
+
+}  // namespace s21
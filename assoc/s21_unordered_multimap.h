@@ -0,0 +1,470 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+
+// The values of one unordered_multimap key, in insertion order. The first
+// N live inline in the table slot, so a key with few values costs no
+// allocation; past N all of them move to one heap array, whose pointer
+// then takes the inline bytes.
+template <class T, std::size_t N, class Allocator>
+class hash_value_list {
+  using Traits = std::allocator_traits<Allocator>;
+  static_assert(N * sizeof(T) >= sizeof(T*));
+
+ public:
+  explicit hash_value_list(const Allocator& alloc) noexcept : alloc_(alloc) {}
+
+  hash_value_list(const hash_value_list& other)
+      : hash_value_list(
+            Traits::select_on_container_copy_construction(other.alloc_)) {
+    reserve(other.size_);
+    for (const T& v : other) emplace_back(v);
+  }
+  hash_value_list(hash_value_list&& other) noexcept
+      : size_(other.size_), capacity_(other.capacity_), alloc_(other.alloc_) {
+    if (other.capacity_ == N) {
+      T* from = other.data();
+      for (std::uint32_t i = 0; i < size_; ++i) {
+        std::construct_at(inline_data() + i, std::move(from[i]));
+        std::destroy_at(from + i);
+      }
+    } else {
+      set_heap(other.heap());
+      other.capacity_ = N;
+    }
+    other.size_ = 0;
+  }
+  hash_value_list& operator=(const hash_value_list&) = delete;
+  hash_value_list& operator=(hash_value_list&&) = delete;
+  ~hash_value_list() {
+    std::destroy_n(data(), size_);
+    if (capacity_ != N) {
+      Allocator alloc(alloc_);
+      Traits::deallocate(alloc, heap(), capacity_);
+    }
+  }
+
+  std::size_t size() const noexcept { return size_; }
+  T* data() noexcept { return capacity_ == N ? inline_data() : heap(); }
+  const T* data() const noexcept {
+    return const_cast<hash_value_list*>(this)->data();
+  }
+  T* begin() noexcept { return data(); }
+  T* end() noexcept { return data() + size_; }
+  const T* begin() const noexcept { return data(); }
+  const T* end() const noexcept { return data() + size_; }
+  T& operator[](std::size_t i) noexcept { return data()[i]; }
+  const T& operator[](std::size_t i) const noexcept { return data()[i]; }
+
+  template <class... Args>
+  T& emplace_back(Args&&... args) {
+    if (size_ == capacity_) {
+      // Built first, so args may refer to a value in this list.
+      T value(std::forward<Args>(args)...);
+      reserve(std::size_t{capacity_} * 2);
+      return *std::construct_at(data() + size_++, std::move(value));
+    }
+    return *std::construct_at(data() + size_++, std::forward<Args>(args)...);
+  }
+
+  void erase(std::size_t i) noexcept {
+    T* d = data();
+    std::move(d + i + 1, d + size_, d + i);
+    std::destroy_at(d + --size_);
+  }
+
+  void reserve(std::size_t n) {
+    if (n <= capacity_) return;
+    if (n > std::numeric_limits<std::uint32_t>::max())
+      throw std::length_error("hash_value_list: too many values");
+    Allocator alloc(alloc_);
+    T* fresh = Traits::allocate(alloc, n);
+    T* old = data();
+    for (std::uint32_t i = 0; i < size_; ++i) {
+      std::construct_at(fresh + i, std::move(old[i]));
+      std::destroy_at(old + i);
+    }
+    if (capacity_ != N) Traits::deallocate(alloc, old, capacity_);
+    set_heap(fresh);
+    capacity_ = static_cast<std::uint32_t>(n);
+  }
+
+ private:
+  T* inline_data() noexcept {
+    return std::launder(reinterpret_cast<T*>(bytes_));
+  }
+  T* heap() noexcept { return *std::launder(reinterpret_cast<T**>(bytes_)); }
+  void set_heap(T* p) noexcept {
+    std::construct_at(reinterpret_cast<T**>(bytes_), p);
+  }
+
+  alignas(T) alignas(T*) unsigned char bytes_[N * sizeof(T)];
+  std::uint32_t size_ = 0;
+  std::uint32_t capacity_ = N;
+  [[no_unique_address]] Allocator alloc_;
+};
+
+// Hash multimap that stores each distinct key once with the list of its
+// values: insert and count are average O(1), and a key with a few values
+// keeps them inline in its slot. Values of a key stay in insertion order.
+// Like btree_map, an iterator yields a std::pair<const Key&, T&> rather
+// than a value_type&. Inserting a new key may rehash and invalidate all
+// iterators; adding a value to a present key may move that key's values.
+template <class Key, class T, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>>
+class unordered_multimap {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = std::pair<const Key&, T&>;
+  using const_reference = std::pair<const Key&, const T&>;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+
+ private:
+  static constexpr std::size_t kInlineValues =
+      std::max<std::size_t>(1, 2 * sizeof(void*) / sizeof(T));
+  using ValueAlloc =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+  using Values = hash_value_list<T, kInlineValues, ValueAlloc>;
+  using Entry = std::pair<const Key, Values>;
+  using EntryAlloc =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Entry>;
+
+ public:
+  using table_type =
+      HashTable<Key, Entry, select_first, Hash, KeyEqual, EntryAlloc>;
+
+  // The index-th value of an entry.
+  template <bool Const>
+  class Iterator {
+    using EntryIt =
+        std::conditional_t<Const, typename table_type::const_iterator,
+                           typename table_type::iterator>;
+
+    EntryIt entry_;
+    size_type index_ = 0;
+    friend class unordered_multimap;
+    friend class Iterator<!Const>;
+
+    Iterator(EntryIt entry, size_type index) : entry_(entry), index_(index) {}
+
+    struct ArrowProxy {
+      std::conditional_t<Const, const_reference,
+                         typename unordered_multimap::reference>
+          ref;
+      const auto* operator->() const noexcept { return &ref; }
+    };
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = typename unordered_multimap::value_type;
+    using reference =
+        std::conditional_t<Const, const_reference,
+                           typename unordered_multimap::reference>;
+    using pointer = ArrowProxy;
+
+    Iterator() = default;
+    template <bool C = Const>
+      requires C
+    Iterator(const Iterator<false>& other)
+        : entry_(other.entry_), index_(other.index_) {}
+
+    reference operator*() const noexcept {
+      return reference(entry_->first, entry_->second[index_]);
+    }
+    pointer operator->() const noexcept { return ArrowProxy{**this}; }
+
+    bool operator==(const Iterator& o) const noexcept {
+      return entry_ == o.entry_ && index_ == o.index_;
+    }
+
+    // >= rather than ==: an iterator made stale by erasing an earlier
+    // value of its key still moves on to the next key.
+    Iterator& operator++() noexcept {
+      if (++index_ >= entry_->second.size()) {
+        ++entry_;
+        index_ = 0;
+      }
+      return *this;
+    }
+    Iterator operator++(int) noexcept {
+      Iterator t(*this);
+      ++(*this);
+      return t;
+    }
+  };
+
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+ private:
+  table_type table_;
+  size_type size_ = 0;
+
+ public:
+  unordered_multimap() = default;
+  explicit unordered_multimap(size_type bucket_count,
+                              const Hash& hash = Hash(),
+                              const KeyEqual& eq = KeyEqual(),
+                              const Allocator& alloc = Allocator())
+      : table_(bucket_count, hash, eq, EntryAlloc(alloc)) {}
+  explicit unordered_multimap(const Allocator& alloc)
+      : table_(0, Hash(), KeyEqual(), EntryAlloc(alloc)) {}
+
+  unordered_multimap(std::initializer_list<value_type> items,
+                     size_type bucket_count = 0, const Hash& hash = Hash(),
+                     const KeyEqual& eq = KeyEqual(),
+                     const Allocator& alloc = Allocator())
+      : unordered_multimap(items.begin(), items.end(), bucket_count, hash,
+                           eq, alloc) {}
+
+  template <std::input_iterator InputIt>
+  unordered_multimap(InputIt first, InputIt last, size_type bucket_count = 0,
+                     const Hash& hash = Hash(),
+                     const KeyEqual& eq = KeyEqual(),
+                     const Allocator& alloc = Allocator())
+      : table_(bucket_count, hash, eq, EntryAlloc(alloc)) {
+    for (; first != last; ++first) insert(*first);
+  }
+
+  unordered_multimap(const unordered_multimap&) = default;
+  unordered_multimap(unordered_multimap&& other) noexcept
+      : table_(std::move(other.table_)),
+        size_(std::exchange(other.size_, 0)) {}
+  ~unordered_multimap() = default;
+  unordered_multimap& operator=(const unordered_multimap&) = default;
+  unordered_multimap& operator=(unordered_multimap&& other) noexcept {
+    if (this != &other) {
+      unordered_multimap tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  iterator begin() noexcept { return iterator(table_.begin(), 0); }
+  const_iterator begin() const noexcept {
+    return const_iterator(table_.begin(), 0);
+  }
+  iterator end() noexcept { return iterator(table_.end(), 0); }
+  const_iterator end() const noexcept {
+    return const_iterator(table_.end(), 0);
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(T);
+  }
+
+  void clear() noexcept {
+    table_.clear();
+    size_ = 0;
+  }
+
+  // Returns the new value, the last one of its key.
+  iterator insert(const value_type& value) {
+    return add(value.first, value.second);
+  }
+  iterator insert(value_type&& value) {
+    return add(value.first, std::move(value.second));
+  }
+  iterator insert(const key_type& key, const mapped_type& obj) {
+    return add(key, obj);
+  }
+  template <class... Args>
+  iterator emplace(Args&&... args) {
+    return insert(value_type(std::forward<Args>(args)...));
+  }
+
+  // Removes one value and returns the one after it. Iterators to later
+  // values of the same key now point one value further on, or past the
+  // key's end, so they are invalidated.
+  iterator erase(const_iterator pos) {
+    --size_;
+    const auto it = table_.mutable_iterator(pos.entry_);
+    Values& values = it->second;
+    if (values.size() == 1) return iterator(table_.erase(pos.entry_), 0);
+    values.erase(pos.index_);
+    if (pos.index_ < values.size()) return iterator(it, pos.index_);
+    return iterator(std::next(it), 0);
+  }
+  // Removes every value of key.
+  size_type erase(const key_type& key) { return erase_all(key); }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual> &&
+             (!std::is_convertible_v<const K&, const_iterator>)
+  size_type erase(const K& key) {
+    return erase_all(key);
+  }
+
+  void swap(unordered_multimap& other) noexcept {
+    table_.swap(other.table_);
+    std::swap(size_, other.size_);
+  }
+
+  // Moves every value over, leaving other empty. A key new to this map
+  // takes other's whole value list. The table and each target list are
+  // sized before anything moves, and a key leaves other only once all its
+  // values have arrived, so if a key copy or an allocation throws, every
+  // value is in exactly one of the two maps.
+  void merge(unordered_multimap& other) {
+    if (this == &other) return;
+    table_.reserve(table_.size() + other.table_.size());
+    for (auto it = other.table_.begin(); it != other.table_.end();) {
+      auto& [key, values] = *it;
+      const size_type n = values.size();
+      auto [to, inserted] = table_.insert_with(key, [&](Entry* slot) {
+        std::construct_at(slot, key, std::move(values));
+      });
+      if (!inserted) {
+        to->second.reserve(to->second.size() + n);
+        for (T& v : values) to->second.emplace_back(std::move(v));
+      }
+      size_ += n;
+      other.size_ -= n;
+      it = other.table_.erase(it);
+    }
+  }
+
+  iterator find(const key_type& key) { return iterator(table_.find(key), 0); }
+  const_iterator find(const key_type& key) const {
+    return const_iterator(table_.find(key), 0);
+  }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual>
+  iterator find(const K& key) {
+    return iterator(table_.find(key), 0);
+  }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual>
+  const_iterator find(const K& key) const {
+    return const_iterator(table_.find(key), 0);
+  }
+
+  bool contains(const key_type& key) const { return find(key) != end(); }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual>
+  bool contains(const K& key) const {
+    return find(key) != end();
+  }
+
+  // O(1): the values of a key are stored together.
+  size_type count(const key_type& key) const { return count_of(key); }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual>
+  size_type count(const K& key) const {
+    return count_of(key);
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type& key) {
+    return range_of<iterator>(table_.find(key), table_.end());
+  }
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type& key) const {
+    return range_of<const_iterator>(table_.find(key), table_.end());
+  }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual>
+  std::pair<iterator, iterator> equal_range(const K& key) {
+    return range_of<iterator>(table_.find(key), table_.end());
+  }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual>
+  std::pair<const_iterator, const_iterator> equal_range(const K& key) const {
+    return range_of<const_iterator>(table_.find(key), table_.end());
+  }
+
+  // Room for n distinct keys without a rehash.
+  void reserve(size_type n) { table_.reserve(n); }
+  void rehash(size_type n) { table_.rehash(n); }
+  size_type bucket_count() const noexcept { return table_.capacity(); }
+  // Distinct keys per slot.
+  float load_factor() const noexcept { return table_.load_factor(); }
+  float max_load_factor() const noexcept {
+    return table_type::max_load_factor();
+  }
+
+  hasher hash_function() const { return table_.hash_function(); }
+  key_equal key_eq() const { return table_.key_eq(); }
+  allocator_type get_allocator() const {
+    return allocator_type(table_.get_allocator());
+  }
+
+  // Reserves room for every argument first, so no insertion rehashes; the
+  // returned iterators hold positions within their key's values, so they
+  // stay valid as later arguments append to the same key.
+  template <class... Args>
+  std::vector<iterator> insert_many(Args&&... args) {
+    reserve(table_.size() + sizeof...(args));
+    std::vector<iterator> res;
+    res.reserve(sizeof...(args));
+    (res.push_back(insert(value_type(std::forward<Args>(args)))), ...);
+    return res;
+  }
+
+ private:
+  template <class... Args>
+  iterator add(const key_type& key, Args&&... args) {
+    auto [it, inserted] = table_.insert_with(key, [&](Entry* slot) {
+      std::construct_at(slot, std::piecewise_construct,
+                        std::forward_as_tuple(key),
+                        std::forward_as_tuple(ValueAlloc(get_allocator())));
+      try {
+        slot->second.emplace_back(std::forward<Args>(args)...);
+      } catch (...) {
+        std::destroy_at(slot);
+        throw;
+      }
+    });
+    if (!inserted) it->second.emplace_back(std::forward<Args>(args)...);
+    ++size_;
+    return iterator(it, it->second.size() - 1);
+  }
+
+  template <class K>
+  size_type count_of(const K& key) const {
+    auto it = table_.find(key);
+    return it == table_.end() ? 0 : it->second.size();
+  }
+
+  template <class It, class EntryIt>
+  static std::pair<It, It> range_of(EntryIt it, EntryIt end) {
+    if (it == end) return {It(end, 0), It(end, 0)};
+    return {It(it, 0), It(std::next(it), 0)};
+  }
+
+  template <class K>
+  size_type erase_all(const K& key) {
+    auto it = table_.find(key);
+    if (it == table_.end()) return 0;
+    const size_type n = it->second.size();
+    table_.erase(it);
+    size_ -= n;
+    return n;
+  }
+};
+
+}  // namespace s21
@@ -0,0 +1,295 @@
+#pragma once
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+
+// Hash multiset that stores each distinct key once together with its
+// number of occurrences: insert and count are average O(1) and duplicates
+// take no memory of their own. Iteration visits every occurrence, each
+// referring to the one stored key, so of several equal keys the first one
+// inserted is the one kept. Inserting a new key may rehash and invalidate
+// iterators; adding another occurrence of a present key never does.
+template <class Key, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<Key>>
+class unordered_multiset {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = const value_type&;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+
+ private:
+  using Entry = std::pair<const Key, size_type>;
+  using EntryAlloc =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Entry>;
+
+ public:
+  using table_type =
+      HashTable<Key, Entry, select_first, Hash, KeyEqual, EntryAlloc>;
+
+  // The index-th occurrence of an entry's key.
+  class const_iterator {
+    using EntryIt = typename table_type::const_iterator;
+
+    EntryIt entry_;
+    size_type index_ = 0;
+    friend class unordered_multiset;
+
+    const_iterator(EntryIt entry, size_type index)
+        : entry_(entry), index_(index) {}
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = Key;
+    using reference = const Key&;
+    using pointer = const Key*;
+
+    const_iterator() = default;
+
+    reference operator*() const noexcept { return entry_->first; }
+    pointer operator->() const noexcept { return &entry_->first; }
+
+    bool operator==(const const_iterator& o) const noexcept {
+      return entry_ == o.entry_ && index_ == o.index_;
+    }
+
+    // >= rather than ==: an iterator made stale by erasing an earlier
+    // occurrence of its key still moves on to the next key.
+    const_iterator& operator++() noexcept {
+      if (++index_ >= entry_->second) {
+        ++entry_;
+        index_ = 0;
+      }
+      return *this;
+    }
+    const_iterator operator++(int) noexcept {
+      const_iterator t(*this);
+      ++(*this);
+      return t;
+    }
+  };
+  using iterator = const_iterator;
+
+ private:
+  table_type table_;
+  size_type size_ = 0;
+
+ public:
+  unordered_multiset() = default;
+  explicit unordered_multiset(size_type bucket_count,
+                              const Hash& hash = Hash(),
+                              const KeyEqual& eq = KeyEqual(),
+                              const Allocator& alloc = Allocator())
+      : table_(bucket_count, hash, eq, EntryAlloc(alloc)) {}
+  explicit unordered_multiset(const Allocator& alloc)
+      : table_(0, Hash(), KeyEqual(), EntryAlloc(alloc)) {}
+
+  unordered_multiset(std::initializer_list<value_type> items,
+                     size_type bucket_count = 0, const Hash& hash = Hash(),
+                     const KeyEqual& eq = KeyEqual(),
+                     const Allocator& alloc = Allocator())
+      : unordered_multiset(items.begin(), items.end(), bucket_count, hash,
+                           eq, alloc) {}
+
+  template <std::input_iterator InputIt>
+  unordered_multiset(InputIt first, InputIt last, size_type bucket_count = 0,
+                     const Hash& hash = Hash(),
+                     const KeyEqual& eq = KeyEqual(),
+                     const Allocator& alloc = Allocator())
+      : table_(bucket_count, hash, eq, EntryAlloc(alloc)) {
+    for (; first != last; ++first) emplace(*first);
+  }
+
+  unordered_multiset(const unordered_multiset&) = default;
+  unordered_multiset(unordered_multiset&& other) noexcept
+      : table_(std::move(other.table_)),
+        size_(std::exchange(other.size_, 0)) {}
+  ~unordered_multiset() = default;
+  unordered_multiset& operator=(const unordered_multiset&) = default;
+  unordered_multiset& operator=(unordered_multiset&& other) noexcept {
+    if (this != &other) {
+      unordered_multiset tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  iterator begin() const noexcept { return iterator(table_.begin(), 0); }
+  iterator end() const noexcept { return iterator(table_.end(), 0); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max();
+  }
+
+  void clear() noexcept {
+    table_.clear();
+    size_ = 0;
+  }
+
+  // Returns the new occurrence, the last one of its key.
+  iterator insert(const value_type& value) { return add(value, 1); }
+  iterator insert(value_type&& value) { return add(std::move(value), 1); }
+  // Adds n occurrences of value at once.
+  iterator insert(const value_type& value, size_type n) {
+    return n ? add(value, n) : find(value);
+  }
+  template <class... Args>
+  iterator emplace(Args&&... args) {
+    return add(Key(std::forward<Args>(args)...), 1);
+  }
+
+  // Removes one occurrence and returns the one after it. Iterators to
+  // later occurrences of the same key are invalidated: the key's count
+  // shrinks beneath them.
+  iterator erase(const_iterator pos) {
+    --size_;
+    size_type& n = table_.mutable_iterator(pos.entry_)->second;
+    if (n == 1) return iterator(table_.erase(pos.entry_), 0);
+    --n;
+    if (pos.index_ < n) return pos;
+    return iterator(std::next(pos.entry_), 0);
+  }
+  // Removes every occurrence of key.
+  size_type erase(const key_type& key) { return erase_all(key); }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual> &&
+             (!std::is_convertible_v<const K&, const_iterator>)
+  size_type erase(const K& key) {
+    return erase_all(key);
+  }
+
+  void swap(unordered_multiset& other) noexcept {
+    table_.swap(other.table_);
+    std::swap(size_, other.size_);
+  }
+
+  // Moves every occurrence over, leaving other empty; a key new to this
+  // set is copied once, whatever its count. The table is sized first and a
+  // key leaves other as soon as it is counted here, so if a key copy
+  // throws, every occurrence is in exactly one of the two sets.
+  void merge(unordered_multiset& other) {
+    if (this == &other) return;
+    table_.reserve(table_.size() + other.table_.size());
+    for (auto it = other.table_.begin(); it != other.table_.end();) {
+      const size_type n = it->second;
+      add(it->first, n);
+      other.size_ -= n;
+      it = other.table_.erase(it);
+    }
+  }
+
+  iterator find(const key_type& key) const {
+    return iterator(table_.find(key), 0);
+  }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual>
+  iterator find(const K& key) const {
+    return iterator(table_.find(key), 0);
+  }
+
+  bool contains(const key_type& key) const { return find(key) != end(); }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual>
+  bool contains(const K& key) const {
+    return find(key) != end();
+  }
+
+  // O(1): the occurrence count is stored with the key.
+  size_type count(const key_type& key) const { return count_of(key); }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual>
+  size_type count(const K& key) const {
+    return count_of(key);
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type& key) const {
+    return range_of(key);
+  }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual>
+  std::pair<iterator, iterator> equal_range(const K& key) const {
+    return range_of(key);
+  }
+
+  // Room for n distinct keys without a rehash.
+  void reserve(size_type n) { table_.reserve(n); }
+  void rehash(size_type n) { table_.rehash(n); }
+  size_type bucket_count() const noexcept { return table_.capacity(); }
+  // Distinct keys per slot.
+  float load_factor() const noexcept { return table_.load_factor(); }
+  float max_load_factor() const noexcept {
+    return table_type::max_load_factor();
+  }
+
+  hasher hash_function() const { return table_.hash_function(); }
+  key_equal key_eq() const { return table_.key_eq(); }
+  allocator_type get_allocator() const {
+    return allocator_type(table_.get_allocator());
+  }
+
+  // Reserves room for every argument first, so no insertion rehashes and
+  // all returned iterators stay valid.
+  template <class... Args>
+  std::vector<iterator> insert_many(Args&&... args) {
+    reserve(table_.size() + sizeof...(args));
+    std::vector<iterator> res;
+    res.reserve(sizeof...(args));
+    (res.push_back(insert(value_type(std::forward<Args>(args)))), ...);
+    return res;
+  }
+
+ private:
+  template <class K>
+  iterator add(K&& key, size_type n) {
+    auto [it, inserted] = table_.insert_with(key, [&](Entry* slot) {
+      std::construct_at(slot, std::forward<K>(key), n);
+    });
+    if (!inserted) it->second += n;
+    size_ += n;
+    return iterator(it, it->second - 1);
+  }
+
+  template <class K>
+  size_type count_of(const K& key) const {
+    auto it = table_.find(key);
+    return it == table_.end() ? 0 : it->second;
+  }
+
+  template <class K>
+  std::pair<iterator, iterator> range_of(const K& key) const {
+    auto it = table_.find(key);
+    if (it == table_.end()) return {end(), end()};
+    return {iterator(it, 0), iterator(std::next(it), 0)};
+  }
+
+  template <class K>
+  size_type erase_all(const K& key) {
+    auto it = table_.find(key);
+    if (it == table_.end()) return 0;
+    const size_type n = it->second;
+    table_.erase(it);
+    size_ -= n;
+    return n;
+  }
+};
+
+}  // namespace s21
@@ -0,0 +1,170 @@
+#pragma once
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+
+// Hash set on an open-addressing Swiss table with the s21::set method set
+// for membership tests: average O(1) find, insert and erase, no ordering.
+// Inserting past the load limit rehashes and invalidates iterators;
+// reserve() ahead of a batch of insertions avoids that.
+template <class Key, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<Key>>
+class unordered_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = const value_type&;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+
+  using table_type =
+      HashTable<Key, Key, identity_key, Hash, KeyEqual, Allocator>;
+  // Keys are never modified in place.
+  using iterator = typename table_type::const_iterator;
+  using const_iterator = typename table_type::const_iterator;
+
+ private:
+  table_type table_;
+
+ public:
+  unordered_set() = default;
+  explicit unordered_set(size_type bucket_count, const Hash& hash = Hash(),
+                         const KeyEqual& eq = KeyEqual(),
+                         const Allocator& alloc = Allocator())
+      : table_(bucket_count, hash, eq, alloc) {}
+  explicit unordered_set(const Allocator& alloc)
+      : table_(0, Hash(), KeyEqual(), alloc) {}
+
+  unordered_set(std::initializer_list<value_type> items,
+                size_type bucket_count = 0, const Hash& hash = Hash(),
+                const KeyEqual& eq = KeyEqual(),
+                const Allocator& alloc = Allocator())
+      : unordered_set(items.begin(), items.end(), bucket_count, hash, eq,
+                      alloc) {}
+
+  template <std::input_iterator InputIt>
+  unordered_set(InputIt first, InputIt last, size_type bucket_count = 0,
+                const Hash& hash = Hash(), const KeyEqual& eq = KeyEqual(),
+                const Allocator& alloc = Allocator())
+      : table_(bucket_count, hash, eq, alloc) {
+    if constexpr (std::forward_iterator<InputIt>)
+      reserve(static_cast<size_type>(std::distance(first, last)));
+    for (; first != last; ++first) emplace(*first);
+  }
+
+  unordered_set(const unordered_set&) = default;
+  unordered_set(unordered_set&&) noexcept = default;
+  ~unordered_set() = default;
+  unordered_set& operator=(const unordered_set&) = default;
+  unordered_set& operator=(unordered_set&&) noexcept = default;
+
+  iterator begin() const noexcept { return table_.begin(); }
+  iterator end() const noexcept { return table_.end(); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return table_.empty(); }
+  size_type size() const noexcept { return table_.size(); }
+  size_type max_size() const noexcept { return table_type::max_size(); }
+
+  void clear() noexcept { table_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return table_.insert_with(
+        value, [&](Key* slot) { std::construct_at(slot, value); });
+  }
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return table_.insert_with(
+        value, [&](Key* slot) { std::construct_at(slot, std::move(value)); });
+  }
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return insert(Key(std::forward<Args>(args)...));
+  }
+
+  // Returns the element that followed pos; other iterators stay valid.
+  iterator erase(const_iterator pos) { return table_.erase(pos); }
+  size_type erase(const key_type& key) { return table_.erase_key(key); }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual> &&
+             (!std::is_convertible_v<const K&, const_iterator>)
+  size_type erase(const K& key) {
+    return table_.erase_key(key);
+  }
+
+  void swap(unordered_set& other) noexcept { table_.swap(other.table_); }
+
+  // Moves in every key not present yet; the rest stay in other. Keys are
+  // moved from only right before other erases them.
+  void merge(unordered_set& other) {
+    if (this == &other) return;
+    for (auto it = other.begin(); it != other.end();) {
+      if (contains(*it)) {
+        ++it;
+        continue;
+      }
+      insert(std::move(const_cast<Key&>(*it)));
+      it = other.erase(it);
+    }
+  }
+
+  iterator find(const key_type& key) const { return table_.find(key); }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual>
+  iterator find(const K& key) const {
+    return table_.find(key);
+  }
+
+  bool contains(const key_type& key) const { return find(key) != end(); }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual>
+  bool contains(const K& key) const {
+    return find(key) != end();
+  }
+
+  size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+  template <class K>
+    requires transparent_hash<Hash, KeyEqual>
+  size_type count(const K& key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  // Room for n elements without a rehash.
+  void reserve(size_type n) { table_.reserve(n); }
+  // At least n slots, and no tombstones left by erase.
+  void rehash(size_type n) { table_.rehash(n); }
+  size_type bucket_count() const noexcept { return table_.capacity(); }
+  float load_factor() const noexcept { return table_.load_factor(); }
+  float max_load_factor() const noexcept {
+    return table_type::max_load_factor();
+  }
+
+  hasher hash_function() const { return table_.hash_function(); }
+  key_equal key_eq() const { return table_.key_eq(); }
+  allocator_type get_allocator() const { return table_.get_allocator(); }
+
+  // Reserves room for every argument first, so no insertion rehashes and
+  // all returned iterators stay valid.
+  template <class... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    reserve(size() + sizeof...(args));
+    std::vector<std::pair<iterator, bool>> res;
+    res.reserve(sizeof...(args));
+    (res.push_back(insert(value_type(std::forward<Args>(args)))), ...);
+    return res;
+  }
+};
+
+}  // namespace s21
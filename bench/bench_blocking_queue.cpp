@@ -0,0 +1,57 @@
+#include <thread>
+#include <vector>
+
+#include "../conc/s21_blocking_queue.h"
+#include "bench_common.h"
+
+namespace {
+
+double per_item(std::size_t n, std::size_t capacity) {
+  s21::blocking_queue<int> q(capacity);
+  return s21_bench::time_ms([&] {
+    std::thread producer([&] {
+      for (std::size_t i = 0; i < n; ++i) q.push(static_cast<int>(i));
+      q.close();
+    });
+    long long sum = 0;
+    int v = 0;
+    while (q.wait_pop(v)) sum += v;
+    producer.join();
+    s21_bench::do_not_optimize(sum);
+  });
+}
+
+double bulk(std::size_t n, std::size_t capacity, std::size_t batch) {
+  s21::blocking_queue<int> q(capacity);
+  return s21_bench::time_ms([&] {
+    std::thread producer([&] {
+      std::vector<int> buf(batch);
+      for (std::size_t i = 0; i < n; i += batch) {
+        const std::size_t len = std::min(batch, n - i);
+        for (std::size_t j = 0; j < len; ++j) buf[j] = static_cast<int>(i + j);
+        q.push_bulk(buf.begin(), buf.begin() + static_cast<long>(len));
+      }
+      q.close();
+    });
+    std::vector<int> out(batch);
+    long long sum = 0;
+    while (std::size_t got = q.pop_bulk(out.data(), batch)) {
+      for (std::size_t j = 0; j < got; ++j) sum += out[j];
+    }
+    producer.join();
+    s21_bench::do_not_optimize(sum);
+  });
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = s21_bench::arg_or(argc, argv, 1, 2000000);
+  s21_bench::report("blocking_queue push/wait_pop", n, per_item(n, 1024));
+  s21_bench::report("blocking_queue push_bulk/pop_bulk (64)", n,
+                    bulk(n, 1024, 64));
+  s21_bench::report("blocking_queue push_bulk/pop_bulk (512)", n,
+                    bulk(n, 1024, 512));
+  s21_bench::report("blocking_queue unbounded bulk (512)", n, bulk(n, 0, 512));
+  return 0;
+}
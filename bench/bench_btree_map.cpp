@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../assoc/s21_btree_map.h"
+#include "../assoc/s21_map.h"
+#include "bench_common.h"
+
+namespace {
+
+template <class F>
+void run(const char* name, std::size_t ops, F&& f) {
+  long long result = 0;
+  s21_bench::report(name, ops, s21_bench::time_ms([&] { result = f(); }));
+  s21_bench::do_not_optimize(result);
+}
+
+// Inserts the keys in the given order, then looks every key up and scans
+// the whole map, repeating the last two until about ops operations ran so
+// that small maps are timed over more than a few microseconds.
+template <class Map>
+void run_map(const char* label, const std::vector<int>& order,
+             std::size_t ops) {
+  const std::size_t n = order.size();
+  const std::size_t rounds = std::max<std::size_t>(1, ops / n);
+  char name[64];
+  Map m;
+  std::snprintf(name, sizeof(name), "%s insert", label);
+  run(name, n, [&] {
+    for (int k : order) m.insert(k, k);
+    return static_cast<long long>(m.size());
+  });
+  std::snprintf(name, sizeof(name), "%s find", label);
+  run(name, n * rounds, [&] {
+    long long sum = 0;
+    for (std::size_t r = 0; r < rounds; ++r)
+      for (int k : order) sum += (*m.find(k)).second;
+    return sum;
+  });
+  std::snprintf(name, sizeof(name), "%s scan", label);
+  run(name, n * rounds, [&] {
+    long long sum = 0;
+    for (std::size_t r = 0; r < rounds; ++r)
+      for (auto it = m.begin(); it != m.end(); ++it) sum += (*it).second;
+    return sum;
+  });
+}
+
+void run_size(std::size_t n) {
+  std::vector<int> order(n);
+  for (std::size_t i = 0; i < n; ++i) order[i] = static_cast<int>(i);
+  std::shuffle(order.begin(), order.end(), std::mt19937(7));
+  std::printf("n = %zu\n", n);
+  constexpr std::size_t kOps = 4000000;
+  run_map<s21::btree_map<int, int>>("btree_map", order, kOps);
+  run_map<s21::map<int, int>>("map", order, kOps);
+}
+
+}  // namespace
+
+// Without an argument runs 1K and 1M elements; pass a size such as
+// 50000000 to time one larger map (about 3 GB for both maps together).
+int main(int argc, char** argv) {
+  if (argc > 1) {
+    run_size(s21_bench::arg_or(argc, argv, 1, 0));
+    return 0;
+  }
+  run_size(1000);
+  run_size(1000000);
+  return 0;
+}
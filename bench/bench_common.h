@@ -0,0 +1,109 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#endif
+
+namespace s21_bench {
+
+class Timer {
+ public:
+  Timer() : start_(std::chrono::steady_clock::now()) {}
+
+  double elapsed_ms() const {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - start_)
+        .count();
+  }
+
+ private:
+  std::chrono::steady_clock::time_point start_;
+};
+
+template <class F>
+double time_ms(F&& f) {
+  Timer t;
+  f();
+  return t.elapsed_ms();
+}
+
+inline void report(const char* name, std::size_t ops, double ms) {
+  std::printf("%-40s %10zu ops %10.2f ms %10.2f Mops/s\n", name, ops, ms,
+              ms > 0 ? static_cast<double>(ops) / ms / 1000.0 : 0.0);
+}
+
+// Keeps the optimizer from discarding a computed value.
+template <class T>
+inline void do_not_optimize(const T& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline std::size_t arg_or(int argc, char** argv, int index,
+                          std::size_t fallback) {
+  return argc > index ? std::strtoull(argv[index], nullptr, 10) : fallback;
+}
+
+// Hardware cache-miss counter for the calling thread. valid() is false when
+// the kernel or the virtual machine exposes no PMU; callers then print n/a
+// rather than fail.
+class CacheMissCounter {
+ public:
+  CacheMissCounter() {
+#ifdef __linux__
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+  }
+  CacheMissCounter(const CacheMissCounter&) = delete;
+  CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+  ~CacheMissCounter() {
+#ifdef __linux__
+    if (fd_ >= 0) close(fd_);
+#endif
+  }
+
+  bool valid() const { return fd_ >= 0; }
+
+  void start() {
+#ifdef __linux__
+    if (!valid()) return;
+    ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+  }
+
+  // Misses since start(), or -1 without a counter.
+  long long stop() {
+#ifdef __linux__
+    if (!valid()) return -1;
+    ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+    std::uint64_t count = 0;
+    if (read(fd_, &count, sizeof(count)) != sizeof(count)) return -1;
+    return static_cast<long long>(count);
+#else
+    return -1;
+#endif
+  }
+
+ private:
+  int fd_ = -1;
+};
+
+}  // namespace s21_bench
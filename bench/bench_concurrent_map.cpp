@@ -0,0 +1,104 @@
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "../assoc/s21_map.h"
+#include "../conc/s21_concurrent_map.h"
+#include "bench_common.h"
+
+namespace {
+
+// The baseline this replaces: s21::map behind one reader-writer lock.
+class locked_map {
+ public:
+  bool contains(int key) const {
+    std::shared_lock<std::shared_mutex> lock(m_);
+    return map_.contains(key);
+  }
+  bool insert(int key, int value) {
+    std::unique_lock<std::shared_mutex> lock(m_);
+    return map_.insert(key, value).second;
+  }
+  bool erase(int key) {
+    std::unique_lock<std::shared_mutex> lock(m_);
+    auto it = map_.find(key);
+    if (it == map_.end()) return false;
+    map_.erase(it);
+    return true;
+  }
+
+ private:
+  mutable std::shared_mutex m_;
+  s21::map<int, int> map_;
+};
+
+// Every thread runs random operations over a key range half of which is
+// present; write_percent of them insert or erase, the rest look up.
+template <class Map>
+double mixed(Map& m, int keys, std::size_t threads, std::size_t ops_per_thread,
+             unsigned write_percent) {
+  for (int k = 0; k < keys; k += 2) m.insert(k, k);
+  return s21_bench::time_ms([&] {
+    std::atomic<bool> go{false};
+    std::vector<std::thread> pool;
+    for (std::size_t t = 0; t < threads; ++t) {
+      pool.emplace_back([&, t] {
+        std::mt19937 rng(static_cast<unsigned>(t) + 1);
+        while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+        long long hits = 0;
+        for (std::size_t i = 0; i < ops_per_thread; ++i) {
+          const unsigned r = rng();
+          const int key = static_cast<int>((r >> 8) % keys);
+          const unsigned op = r % 100;
+          if (op >= write_percent)
+            hits += m.contains(key);
+          else if (op % 2 == 0)
+            hits += m.insert(key, key);
+          else
+            hits += m.erase(key);
+        }
+        s21_bench::do_not_optimize(hits);
+      });
+    }
+    go.store(true, std::memory_order_release);
+    for (auto& th : pool) th.join();
+  });
+}
+
+void run_mix(const char* label, int keys, std::size_t ops,
+             std::size_t max_threads, unsigned write_percent) {
+  std::printf("%s: %u%% writes, %d keys\n", label, write_percent, keys);
+  char name[64];
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    const std::size_t total = ops * threads;
+    {
+      s21::concurrent_map<int, int> m;
+      std::snprintf(name, sizeof(name), "concurrent_map %zu threads",
+                    threads);
+      s21_bench::report(name, total,
+                        mixed(m, keys, threads, ops, write_percent));
+    }
+    {
+      locked_map m;
+      std::snprintf(name, sizeof(name), "shared_mutex + s21::map %zu threads",
+                    threads);
+      s21_bench::report(name, total,
+                        mixed(m, keys, threads, ops, write_percent));
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t ops = s21_bench::arg_or(argc, argv, 1, 500000);
+  const std::size_t max_threads = s21_bench::arg_or(argc, argv, 2, 8);
+  const int keys = static_cast<int>(s21_bench::arg_or(argc, argv, 3, 100000));
+  run_mix("read-heavy", keys, ops, max_threads, 10);
+  run_mix("write-heavy", keys, ops, max_threads, 100);
+  return 0;
+}
@@ -0,0 +1,121 @@
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../assoc/s21_multiset.h"
+#include "../seq/s21_indexed_heap.h"
+#include "../seq/s21_priority_queue.h"
+#include "bench_common.h"
+
+namespace {
+
+using Graph = std::vector<std::vector<std::pair<int, int>>>;
+constexpr long long kInf = 1LL << 60;
+
+Graph random_graph(int n, int degree) {
+  std::mt19937 rng(2024);
+  Graph g(n);
+  for (int u = 0; u < n; ++u) {
+    g[u].push_back({(u + 1) % n, static_cast<int>(rng() % 100 + 1)});
+    for (int e = 1; e < degree; ++e)
+      g[u].push_back({static_cast<int>(rng() % static_cast<unsigned>(n)),
+                      static_cast<int>(rng() % 100 + 1)});
+  }
+  return g;
+}
+
+long long dijkstra_indexed(const Graph& g) {
+  const int n = static_cast<int>(g.size());
+  std::vector<long long> dist(n, kInf);
+  std::vector<std::size_t> handle(n);
+  std::vector<bool> queued(n, false);
+  s21::indexed_heap<std::pair<long long, int>> pq;
+  pq.reserve(static_cast<std::size_t>(n));
+  dist[0] = 0;
+  handle[0] = pq.push({0, 0});
+  queued[0] = true;
+  while (!pq.empty()) {
+    const auto [d, u] = pq.top();
+    pq.pop();
+    for (auto [v, w] : g[u]) {
+      const long long nd = d + w;
+      if (nd >= dist[v]) continue;
+      dist[v] = nd;
+      if (queued[v] && pq.contains(handle[v])) {
+        pq.decrease_key(handle[v], {nd, v});
+      } else {
+        handle[v] = pq.push({nd, v});
+        queued[v] = true;
+      }
+    }
+  }
+  long long sum = 0;
+  for (long long d : dist) sum += d;
+  return sum;
+}
+
+long long dijkstra_multiset(const Graph& g) {
+  const int n = static_cast<int>(g.size());
+  std::vector<long long> dist(n, kInf);
+  s21::multiset<std::pair<long long, int>> pq;
+  dist[0] = 0;
+  pq.insert({0, 0});
+  while (!pq.empty()) {
+    const auto [d, u] = *pq.begin();
+    pq.erase(pq.begin());
+    for (auto [v, w] : g[u]) {
+      const long long nd = d + w;
+      if (nd >= dist[v]) continue;
+      if (dist[v] != kInf) pq.erase(pq.find({dist[v], v}));
+      dist[v] = nd;
+      pq.insert({nd, v});
+    }
+  }
+  long long sum = 0;
+  for (long long d : dist) sum += d;
+  return sum;
+}
+
+// Lazy-deletion variant: stale entries stay in the heap and are skipped.
+long long dijkstra_lazy(const Graph& g) {
+  const int n = static_cast<int>(g.size());
+  std::vector<long long> dist(n, kInf);
+  s21::priority_queue<std::pair<long long, int>,
+                      std::greater<std::pair<long long, int>>>
+      pq;
+  dist[0] = 0;
+  pq.push({0, 0});
+  while (!pq.empty()) {
+    const auto [d, u] = pq.top();
+    pq.pop();
+    if (d != dist[u]) continue;
+    for (auto [v, w] : g[u]) {
+      const long long nd = d + w;
+      if (nd >= dist[v]) continue;
+      dist[v] = nd;
+      pq.push({nd, v});
+    }
+  }
+  long long sum = 0;
+  for (long long d : dist) sum += d;
+  return sum;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const int n = static_cast<int>(s21_bench::arg_or(argc, argv, 1, 200000));
+  const int degree = static_cast<int>(s21_bench::arg_or(argc, argv, 2, 8));
+  const Graph g = random_graph(n, degree);
+  const std::size_t edges = static_cast<std::size_t>(n) * degree;
+
+  long long a = 0, b = 0, c = 0;
+  s21_bench::report("dijkstra indexed_heap decrease_key", edges,
+                    s21_bench::time_ms([&] { a = dijkstra_indexed(g); }));
+  s21_bench::report("dijkstra multiset find+erase+insert", edges,
+                    s21_bench::time_ms([&] { b = dijkstra_multiset(g); }));
+  s21_bench::report("dijkstra priority_queue lazy delete", edges,
+                    s21_bench::time_ms([&] { c = dijkstra_lazy(g); }));
+  if (a != b || a != c) std::printf("MISMATCH %lld %lld %lld\n", a, b, c);
+  return 0;
+}
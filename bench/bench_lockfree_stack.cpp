@@ -0,0 +1,78 @@
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../conc/s21_lockfree_stack.h"
+#include "../seq/s21_stack.h"
+#include "bench_common.h"
+
+namespace {
+
+class locked_stack {
+ public:
+  void push(int v) {
+    std::lock_guard<std::mutex> lock(m_);
+    s_.push(v);
+  }
+  bool try_pop(int& out) {
+    std::lock_guard<std::mutex> lock(m_);
+    if (s_.empty()) return false;
+    out = s_.top();
+    s_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex m_;
+  s21::stack<int> s_;
+};
+
+// Every thread alternates push and pop, the free-list access pattern.
+template <class S>
+double contention(S& s, std::size_t threads, std::size_t ops_per_thread) {
+  for (int i = 0; i < 1024; ++i) s.push(i);
+  return s21_bench::time_ms([&] {
+    std::atomic<bool> go{false};
+    std::vector<std::thread> pool;
+    for (std::size_t t = 0; t < threads; ++t) {
+      pool.emplace_back([&] {
+        while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+        long long sum = 0;
+        int v = 0;
+        for (std::size_t i = 0; i < ops_per_thread; ++i) {
+          if (s.try_pop(v)) sum += v;
+          s.push(static_cast<int>(i));
+        }
+        s21_bench::do_not_optimize(sum);
+      });
+    }
+    go.store(true, std::memory_order_release);
+    for (auto& th : pool) th.join();
+  });
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t ops = s21_bench::arg_or(argc, argv, 1, 500000);
+  const std::size_t max_threads = s21_bench::arg_or(argc, argv, 2, 8);
+
+  char name[64];
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    const std::size_t total = 2 * ops * threads;
+    {
+      s21::lockfree_stack<int> s;
+      std::snprintf(name, sizeof(name), "lockfree_stack %zu threads", threads);
+      s21_bench::report(name, total, contention(s, threads, ops));
+    }
+    {
+      locked_stack s;
+      std::snprintf(name, sizeof(name), "mutex + s21::stack %zu threads",
+                    threads);
+      s21_bench::report(name, total, contention(s, threads, ops));
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,102 @@
+#include <map>
+#include <random>
+#include <vector>
+
+#include "../assoc/s21_map.h"
+#include "bench_common.h"
+
+namespace {
+
+std::vector<int> random_keys(std::size_t n, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::vector<int> keys(n);
+  for (int& k : keys) k = static_cast<int>(rng());
+  return keys;
+}
+
+// Thin adapters so every workload is written once.
+void put(s21::map<int, int>& m, int k, int v) { m.insert(k, v); }
+void put(std::map<int, int>& m, int k, int v) { m.emplace(k, v); }
+
+template <class Map>
+void drop(Map& m, int k) {
+  auto it = m.find(k);
+  if (it != m.end()) m.erase(it);
+}
+
+// Steady state: the map holds `size` keys and every step replaces the
+// oldest key with a fresh one, so nodes are freed and reallocated forever.
+template <class Map>
+long long sliding_window(const std::vector<int>& keys, std::size_t size) {
+  Map m;
+  for (std::size_t i = 0; i < size; ++i) put(m, keys[i], 1);
+  for (std::size_t i = size; i < keys.size(); ++i) {
+    drop(m, keys[i - size]);
+    put(m, keys[i], 1);
+  }
+  long long sum = 0;
+  for (std::size_t i = keys.size() - size; i < keys.size(); ++i) {
+    auto it = m.find(keys[i]);
+    if (it != m.end()) sum += (*it).second;
+  }
+  return sum;
+}
+
+// Random 50/50 insert/erase over a small key range.
+template <class Map>
+long long random_mix(std::size_t ops, int range) {
+  Map m;
+  std::mt19937 rng(11);
+  for (std::size_t i = 0; i < ops; ++i) {
+    const int k = static_cast<int>(rng() % static_cast<unsigned>(range));
+    if (rng() & 1u)
+      put(m, k, k);
+    else
+      drop(m, k);
+  }
+  return static_cast<long long>(m.size());
+}
+
+// Many short-lived maps: build, probe, destroy.
+template <class Map>
+long long build_and_clear(const std::vector<int>& keys, std::size_t rounds) {
+  long long total = 0;
+  for (std::size_t r = 0; r < rounds; ++r) {
+    Map m;
+    for (int k : keys) put(m, k, k);
+    total += static_cast<long long>(m.size());
+  }
+  return total;
+}
+
+template <class F>
+void run(const char* name, std::size_t ops, F&& f) {
+  long long result = 0;
+  s21_bench::report(name, ops, s21_bench::time_ms([&] { result = f(); }));
+  s21_bench::do_not_optimize(result);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = s21_bench::arg_or(argc, argv, 1, 1000000);
+  const std::size_t window = s21_bench::arg_or(argc, argv, 2, 100000);
+  const std::vector<int> keys = random_keys(n + window, 3);
+  const std::vector<int> small = random_keys(1000, 5);
+
+  run("sliding window s21::map", n,
+      [&] { return sliding_window<s21::map<int, int>>(keys, window); });
+  run("sliding window std::map", n,
+      [&] { return sliding_window<std::map<int, int>>(keys, window); });
+  run("random insert/erase s21::map", n,
+      [&] { return random_mix<s21::map<int, int>>(n, 1 << 16); });
+  run("random insert/erase std::map", n,
+      [&] { return random_mix<std::map<int, int>>(n, 1 << 16); });
+  run("build+destroy 1k s21::map", n, [&] {
+    return build_and_clear<s21::map<int, int>>(small, n / small.size());
+  });
+  run("build+destroy 1k std::map", n, [&] {
+    return build_and_clear<std::map<int, int>>(small, n / small.size());
+  });
+  return 0;
+}
@@ -0,0 +1,62 @@
+#include <cstdio>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../assoc/s21_map.h"
+#include "bench_common.h"
+
+namespace {
+
+void put(s21::map<int, int>& m, int k) { m.insert(k, k); }
+void put(std::map<int, int>& m, int k) { m.emplace(k, k); }
+
+// Random successful lookups in a map far larger than the last-level cache,
+// so nearly every level of the descent is a miss and node size decides how
+// many distinct lines a search touches.
+template <class Map>
+void find_random(const char* name, const std::vector<int>& keys,
+                 const std::vector<int>& probes) {
+  Map m;
+  for (int k : keys) put(m, k);
+
+  s21_bench::CacheMissCounter misses;
+  long long sum = 0;
+  misses.start();
+  const double ms = s21_bench::time_ms([&] {
+    for (int k : probes) sum += (*m.find(k)).second;
+  });
+  const long long missed = misses.stop();
+  s21_bench::do_not_optimize(sum);
+
+  s21_bench::report(name, probes.size(), ms);
+  const double n = static_cast<double>(probes.size());
+  if (missed >= 0)
+    std::printf("%-40s %10.1f ns/find %8.2f misses/find\n", "", ms * 1e6 / n,
+                static_cast<double>(missed) / n);
+  else
+    std::printf("%-40s %10.1f ns/find %8s misses/find\n", "", ms * 1e6 / n,
+                "n/a");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = s21_bench::arg_or(argc, argv, 1, 4000000);
+  const std::size_t lookups = s21_bench::arg_or(argc, argv, 2, 4000000);
+
+  std::mt19937 rng(17);
+  std::vector<int> keys(n);
+  // Multiplying by an odd constant scatters the keys without repeats.
+  for (std::size_t i = 0; i < n; ++i)
+    keys[i] = static_cast<int>(i * 2654435761u);
+  std::vector<int> probes(lookups);
+  for (int& p : probes) p = keys[rng() % n];
+
+  std::printf("node bytes: s21::map<int, int> %zu\n",
+              sizeof(s21::Node<std::pair<const int, int>>));
+  find_random<s21::map<int, int>>("random find s21::map", keys, probes);
+  find_random<std::map<int, int>>("random find std::map", keys, probes);
+  return 0;
+}
@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../assoc/s21_map.h"
+#include "bench_common.h"
+
+namespace {
+
+template <class F>
+void run(const char* name, std::size_t ops, F&& f) {
+  long long result = 0;
+  s21_bench::report(name, ops, s21_bench::time_ms([&] { result = f(); }));
+  s21_bench::do_not_optimize(result);
+}
+
+// Loads ascending keys; with the end() hint every element lands next to
+// the current maximum.
+template <class Map>
+long long load_sorted(const std::vector<int>& keys, bool hinted) {
+  Map m;
+  if (hinted) {
+    for (int k : keys) m.insert(m.end(), {k, k});
+  } else {
+    for (int k : keys) m.insert({k, k});
+  }
+  return static_cast<long long>(m.size());
+}
+
+template <class Map>
+long long load_each(const std::vector<std::pair<const int, int>>& items) {
+  Map m;
+  for (const auto& kv : items) m.insert(kv);
+  return static_cast<long long>(m.size());
+}
+
+// Range construction: s21::map checks the order and then links a balanced
+// tree in one pass (or sorts pointers first); std::map inserts each element
+// with the end() hint.
+template <class Map>
+long long load_range(const std::vector<std::pair<const int, int>>& items) {
+  Map m(items.begin(), items.end());
+  return static_cast<long long>(m.size());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = s21_bench::arg_or(argc, argv, 1, 2000000);
+  std::vector<int> keys(n);
+  for (std::size_t i = 0; i < n; ++i) keys[i] = static_cast<int>(i);
+
+  using S21Map = s21::map<int, int>;
+  using StdMap = std::map<int, int>;
+  run("sorted load s21::map insert", n,
+      [&] { return load_sorted<S21Map>(keys, false); });
+  run("sorted load s21::map insert(end)", n,
+      [&] { return load_sorted<S21Map>(keys, true); });
+  run("sorted load std::map insert", n,
+      [&] { return load_sorted<StdMap>(keys, false); });
+  run("sorted load std::map insert(end)", n,
+      [&] { return load_sorted<StdMap>(keys, true); });
+
+  std::vector<std::pair<const int, int>> sorted;
+  sorted.reserve(n);
+  for (int k : keys) sorted.emplace_back(k, k);
+  run("sorted load s21::map range ctor", n,
+      [&] { return load_range<S21Map>(sorted); });
+  run("sorted load s21::map sorted_unique", n, [&] {
+    S21Map m(s21::sorted_unique, sorted.begin(), sorted.end());
+    return static_cast<long long>(m.size());
+  });
+  run("sorted load std::map range ctor", n,
+      [&] { return load_range<StdMap>(sorted); });
+
+  std::vector<int> order = keys;
+  std::shuffle(order.begin(), order.end(), std::mt19937(3));
+  std::vector<std::pair<const int, int>> shuffled;
+  shuffled.reserve(n);
+  for (int k : order) shuffled.emplace_back(k, k);
+  run("shuffled load s21::map insert", n,
+      [&] { return load_each<S21Map>(shuffled); });
+  run("shuffled load s21::map range ctor", n,
+      [&] { return load_range<S21Map>(shuffled); });
+  run("shuffled load std::map insert", n,
+      [&] { return load_each<StdMap>(shuffled); });
+  return 0;
+}
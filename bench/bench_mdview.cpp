@@ -0,0 +1,115 @@
+#include <cstdio>
+
+#include "../seq/s21_mdview.h"
+#include "../seq/s21_vector.h"
+#include "bench_common.h"
+
+namespace {
+
+using Matrix = s21::mdview<float, s21::dextents<2>>;
+using ConstMatrix = s21::mdview<const float, s21::dextents<2>>;
+
+void fill(s21::vector<float>& v) {
+  for (std::size_t i = 0; i < v.size(); ++i)
+    v[i] = static_cast<float>((i * 7919) % 1000) * 0.001f;
+}
+
+void transpose_naive(ConstMatrix a, Matrix b) {
+  for (std::size_t i = 0; i < a.extent(0); ++i)
+    for (std::size_t j = 0; j < a.extent(1); ++j) b(j, i) = a(i, j);
+}
+
+// Loop tiling: both the source rows and the destination rows of a block
+// stay cache-resident while it is copied.
+void transpose_blocked(ConstMatrix a, Matrix b, std::size_t block) {
+  const std::size_t rows = a.extent(0), cols = a.extent(1);
+  for (std::size_t ii = 0; ii < rows; ii += block)
+    for (std::size_t jj = 0; jj < cols; jj += block) {
+      const std::size_t ie = ii + block < rows ? ii + block : rows;
+      const std::size_t je = jj + block < cols ? jj + block : cols;
+      for (std::size_t i = ii; i < ie; ++i)
+        for (std::size_t j = jj; j < je; ++j) b(j, i) = a(i, j);
+    }
+}
+
+// Destination in a tiled layout: writes of a column walk stay in one tile.
+template <class Tiled>
+void transpose_to_tiled(ConstMatrix a, Tiled b) {
+  for (std::size_t i = 0; i < a.extent(0); ++i)
+    for (std::size_t j = 0; j < a.extent(1); ++j) b(j, i) = a(i, j);
+}
+
+void matmul_ijk(ConstMatrix a, ConstMatrix b, Matrix c) {
+  const std::size_t n = a.extent(0), k = a.extent(1), m = b.extent(1);
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t j = 0; j < m; ++j) {
+      float sum = 0;
+      for (std::size_t p = 0; p < k; ++p) sum += a(i, p) * b(p, j);
+      c(i, j) = sum;
+    }
+}
+
+// i-k-j order makes the inner loop a contiguous axpy over a row of C.
+template <class A, class B, class C>
+void matmul_ikj(A a, B b, C c) {
+  const std::size_t n = a.extent(0), k = a.extent(1), m = b.extent(1);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < m; ++j) c(i, j) = 0;
+    for (std::size_t p = 0; p < k; ++p) {
+      const float aip = a(i, p);
+      for (std::size_t j = 0; j < m; ++j) c(i, j) += aip * b(p, j);
+    }
+  }
+}
+
+template <std::size_t N>
+double matmul_static_ms(const s21::vector<float>& a,
+                        const s21::vector<float>& b, s21::vector<float>& c) {
+  using E = s21::extents<N, N>;
+  s21::mdview<const float, E> va(a);
+  s21::mdview<const float, E> vb(b);
+  s21::mdview<float, E> vc(c);
+  return s21_bench::time_ms([&] { matmul_ikj(va, vb, vc); });
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = s21_bench::arg_or(argc, argv, 1, 2048);
+  constexpr std::size_t kMul = 256;
+
+  s21::vector<float> src(n * n), dst(n * n);
+  fill(src);
+  ConstMatrix a(src, n, n);
+  Matrix b(dst, n, n);
+  s21_bench::report("transpose naive", n * n,
+                    s21_bench::time_ms([&] { transpose_naive(a, b); }));
+  s21_bench::report("transpose blocked 32", n * n, s21_bench::time_ms([&] {
+                      transpose_blocked(a, b, 32);
+                    }));
+  {
+    using Tiled = s21::mdview<float, s21::dextents<2>, s21::layout_tiled<16>>;
+    const Tiled::mapping_type map(s21::dextents<2>(n, n));
+    s21::vector<float> tiled(map.required_span_size());
+    Tiled t(tiled, map);
+    s21_bench::report("transpose into layout_tiled<16>", n * n,
+                      s21_bench::time_ms([&] { transpose_to_tiled(a, t); }));
+    s21_bench::do_not_optimize(tiled[0]);
+  }
+  s21_bench::do_not_optimize(dst[1]);
+
+  s21::vector<float> ma(kMul * kMul), mb(kMul * kMul), mc(kMul * kMul);
+  fill(ma);
+  fill(mb);
+  const std::size_t flops = 2 * kMul * kMul * kMul;
+  ConstMatrix da(ma, kMul, kMul), db(mb, kMul, kMul);
+  Matrix dc(mc, kMul, kMul);
+  s21_bench::report("matmul ijk dynamic extents", flops,
+                    s21_bench::time_ms([&] { matmul_ijk(da, db, dc); }));
+  s21_bench::report("matmul ikj dynamic extents", flops,
+                    s21_bench::time_ms([&] { matmul_ikj(da, db, dc); }));
+  s21_bench::report("matmul ikj static extents", flops,
+                    matmul_static_ms<kMul>(ma, mb, mc));
+  s21_bench::do_not_optimize(mc[kMul + 1]);
+  return 0;
+}
@@ -0,0 +1,85 @@
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../conc/s21_mpmc_queue.h"
+#include "../seq/s21_queue.h"
+#include "bench_common.h"
+
+namespace {
+
+class locked_queue {
+ public:
+  void push(int v) {
+    std::lock_guard<std::mutex> lock(m_);
+    q_.push(v);
+  }
+  bool try_pop(int& out) {
+    std::lock_guard<std::mutex> lock(m_);
+    if (q_.empty()) return false;
+    out = q_.front();
+    q_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex m_;
+  s21::queue<int> q_;
+};
+
+template <class Q>
+double run(Q& q, int producers, int consumers, std::size_t per_producer) {
+  const std::size_t total = per_producer * static_cast<std::size_t>(producers);
+  std::atomic<std::size_t> consumed{0};
+  return s21_bench::time_ms([&] {
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+      threads.emplace_back([&] {
+        for (std::size_t i = 0; i < per_producer; ++i)
+          q.push(static_cast<int>(i));
+      });
+    }
+    for (int c = 0; c < consumers; ++c) {
+      threads.emplace_back([&] {
+        int v = 0;
+        long long sum = 0;
+        while (consumed.load(std::memory_order_relaxed) < total) {
+          if (q.try_pop(v)) {
+            sum += v;
+            consumed.fetch_add(1, std::memory_order_relaxed);
+          } else {
+            std::this_thread::yield();
+          }
+        }
+        s21_bench::do_not_optimize(sum);
+      });
+    }
+    for (auto& t : threads) t.join();
+  });
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t per_producer = s21_bench::arg_or(argc, argv, 1, 500000);
+  const int max_threads = static_cast<int>(s21_bench::arg_or(
+      argc, argv, 2, std::max(2u, std::thread::hardware_concurrency())));
+
+  char name[64];
+  for (int n = 1; n <= max_threads; n *= 2) {
+    const std::size_t ops = per_producer * static_cast<std::size_t>(n);
+    {
+      s21::mpmc_queue<int> q(1024);
+      std::snprintf(name, sizeof(name), "mpmc_queue %dP/%dC", n, n);
+      s21_bench::report(name, ops, run(q, n, n, per_producer));
+    }
+    {
+      locked_queue q;
+      std::snprintf(name, sizeof(name), "mutex + s21::queue %dP/%dC", n, n);
+      s21_bench::report(name, ops, run(q, n, n, per_producer));
+    }
+  }
+  return 0;
+}
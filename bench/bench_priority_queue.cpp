@@ -0,0 +1,91 @@
+#include <random>
+#include <vector>
+
+#include "../assoc/s21_multiset.h"
+#include "../seq/s21_priority_queue.h"
+#include "bench_common.h"
+
+namespace {
+
+std::vector<int> random_keys(std::size_t n) {
+  std::mt19937 rng(12345);
+  std::vector<int> keys(n);
+  for (auto& k : keys) k = static_cast<int>(rng());
+  return keys;
+}
+
+template <class PQ>
+double heap_push_pop(const std::vector<int>& keys) {
+  return s21_bench::time_ms([&] {
+    PQ pq;
+    for (int k : keys) pq.push(k);
+    long long sum = 0;
+    while (!pq.empty()) {
+      sum += pq.top();
+      pq.pop();
+    }
+    s21_bench::do_not_optimize(sum);
+  });
+}
+
+double multiset_push_pop(const std::vector<int>& keys) {
+  return s21_bench::time_ms([&] {
+    s21::multiset<int> ms;
+    for (int k : keys) ms.insert(k);
+    long long sum = 0;
+    while (!ms.empty()) {
+      auto it = ms.end();
+      --it;
+      sum += *it;
+      ms.erase(it);
+    }
+    s21_bench::do_not_optimize(sum);
+  });
+}
+
+// Scheduler-style churn: keep n items, repeatedly take the top and
+// re-insert it with a new priority.
+template <class PQ>
+double heap_churn(const std::vector<int>& keys, std::size_t rounds) {
+  PQ pq(keys.begin(), keys.end());
+  return s21_bench::time_ms([&] {
+    for (std::size_t i = 0; i < rounds; ++i)
+      pq.pop_push(keys[i % keys.size()] ^ static_cast<int>(i));
+    s21_bench::do_not_optimize(pq.top());
+  });
+}
+
+double multiset_churn(const std::vector<int>& keys, std::size_t rounds) {
+  s21::multiset<int> ms;
+  for (int k : keys) ms.insert(k);
+  return s21_bench::time_ms([&] {
+    for (std::size_t i = 0; i < rounds; ++i) {
+      auto it = ms.end();
+      --it;
+      ms.erase(it);
+      ms.insert(keys[i % keys.size()] ^ static_cast<int>(i));
+    }
+    s21_bench::do_not_optimize(ms.size());
+  });
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = s21_bench::arg_or(argc, argv, 1, 1000000);
+  const auto keys = random_keys(n);
+
+  using binary = s21::priority_queue<int>;
+  using quad = s21::priority_queue<int, std::less<int>, s21::vector<int>, 4>;
+
+  s21_bench::report("push+pop binary heap", n, heap_push_pop<binary>(keys));
+  s21_bench::report("push+pop 4-ary heap", n, heap_push_pop<quad>(keys));
+  s21_bench::report("push+pop s21::multiset", n, multiset_push_pop(keys));
+
+  s21_bench::report("pop_push churn binary heap", n,
+                    heap_churn<binary>(keys, n));
+  s21_bench::report("pop_push churn 4-ary heap", n, heap_churn<quad>(keys, n));
+  s21_bench::report("erase+insert churn s21::multiset", n,
+                    multiset_churn(keys, n));
+  return 0;
+}
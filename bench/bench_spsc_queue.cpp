@@ -0,0 +1,131 @@
+#include <mutex>
+#include <thread>
+
+#include "../conc/s21_spsc_queue.h"
+#include "../seq/s21_queue.h"
+#include "bench_common.h"
+
+namespace {
+
+class locked_queue {
+ public:
+  bool try_push(int v) {
+    std::lock_guard<std::mutex> lock(m_);
+    q_.push(v);
+    return true;
+  }
+  bool try_pop(int& out) {
+    std::lock_guard<std::mutex> lock(m_);
+    if (q_.empty()) return false;
+    out = q_.front();
+    q_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex m_;
+  s21::queue<int> q_;
+};
+
+template <class Q>
+double throughput(Q& q, std::size_t n) {
+  return s21_bench::time_ms([&] {
+    std::thread producer([&] {
+      for (std::size_t i = 0; i < n; ++i) {
+        while (!q.try_push(static_cast<int>(i))) std::this_thread::yield();
+      }
+    });
+    long long sum = 0;
+    int v = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      while (!q.try_pop(v)) std::this_thread::yield();
+      sum += v;
+    }
+    producer.join();
+    s21_bench::do_not_optimize(sum);
+  });
+}
+
+double batched_throughput(s21::spsc_queue<int>& q, std::size_t n) {
+  constexpr std::size_t kBatch = 64;
+  return s21_bench::time_ms([&] {
+    std::thread producer([&] {
+      int buf[kBatch];
+      for (std::size_t i = 0; i < n;) {
+        const std::size_t want = std::min(kBatch, n - i);
+        for (std::size_t j = 0; j < want; ++j) buf[j] = static_cast<int>(i + j);
+        std::size_t done = 0;
+        while (done < want) {
+          const std::size_t pushed = q.push_n(buf + done, want - done);
+          if (pushed == 0) std::this_thread::yield();
+          done += pushed;
+        }
+        i += want;
+      }
+    });
+    int buf[kBatch];
+    long long sum = 0;
+    for (std::size_t got = 0; got < n;) {
+      const std::size_t popped = q.pop_n(buf, kBatch);
+      if (popped == 0) std::this_thread::yield();
+      for (std::size_t j = 0; j < popped; ++j) sum += buf[j];
+      got += popped;
+    }
+    producer.join();
+    s21_bench::do_not_optimize(sum);
+  });
+}
+
+// Round trip through a pair of queues; reports the mean one-way latency.
+template <class Q>
+double ping_pong_ns(Q& there, Q& back, std::size_t rounds) {
+  const double ms = s21_bench::time_ms([&] {
+    std::thread echo([&] {
+      int v = 0;
+      for (std::size_t i = 0; i < rounds; ++i) {
+        while (!there.try_pop(v)) std::this_thread::yield();
+        while (!back.try_push(v)) std::this_thread::yield();
+      }
+    });
+    int v = 0;
+    for (std::size_t i = 0; i < rounds; ++i) {
+      while (!there.try_push(static_cast<int>(i))) std::this_thread::yield();
+      while (!back.try_pop(v)) std::this_thread::yield();
+    }
+    echo.join();
+  });
+  return ms * 1e6 / static_cast<double>(rounds) / 2.0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = s21_bench::arg_or(argc, argv, 1, 2000000);
+  const std::size_t rounds = s21_bench::arg_or(argc, argv, 2, 100000);
+
+  {
+    s21::spsc_queue<int> q(4096);
+    s21_bench::report("spsc_queue try_push/try_pop", n, throughput(q, n));
+  }
+  {
+    s21::spsc_queue<int> q(4096);
+    s21_bench::report("spsc_queue push_n/pop_n (64)", n,
+                      batched_throughput(q, n));
+  }
+  {
+    locked_queue q;
+    s21_bench::report("mutex + s21::queue", n, throughput(q, n));
+  }
+
+  {
+    s21::spsc_queue<int> a(64), b(64);
+    std::printf("%-40s %10.1f ns one-way\n", "spsc_queue latency",
+                ping_pong_ns(a, b, rounds));
+  }
+  {
+    locked_queue a, b;
+    std::printf("%-40s %10.1f ns one-way\n", "mutex + s21::queue latency",
+                ping_pong_ns(a, b, rounds));
+  }
+  return 0;
+}
@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+#include "../conc/s21_thread_pool.h"
+#include "../seq/s21_vector.h"
+#include "bench_common.h"
+
+namespace {
+
+constexpr std::size_t kCutoff = 4096;
+
+void fill(s21::vector<int>& v) {
+  std::uint32_t x = 2463534242u;
+  for (std::size_t i = 0; i < v.size(); ++i) {
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    v[i] = static_cast<int>(x);
+  }
+}
+
+// Hoare partition around the median of three; returns the split point.
+int* partition(int* first, int* last) {
+  int* mid = first + (last - first - 1) / 2;
+  if (*mid < *first) std::swap(*mid, *first);
+  if (*(last - 1) < *mid) std::swap(*(last - 1), *mid);
+  if (*mid < *first) std::swap(*mid, *first);
+  const int pivot = *mid;
+  int* i = first - 1;
+  int* j = last;
+  for (;;) {
+    do ++i;
+    while (*i < pivot);
+    do --j;
+    while (*j > pivot);
+    if (i >= j) return j + 1;
+    std::swap(*i, *j);
+  }
+}
+
+void serial_sort(int* first, int* last) {
+  while (last - first > static_cast<std::ptrdiff_t>(kCutoff)) {
+    int* split = partition(first, last);
+    serial_sort(first, split);
+    first = split;
+  }
+  std::sort(first, last);
+}
+
+void parallel_sort(s21::thread_pool& pool, int* first, int* last) {
+  if (last - first <= static_cast<std::ptrdiff_t>(kCutoff)) {
+    std::sort(first, last);
+    return;
+  }
+  int* split = partition(first, last);
+  pool.invoke([&] { parallel_sort(pool, first, split); },
+              [&] { parallel_sort(pool, split, last); });
+}
+
+bool sorted(const s21::vector<int>& v) {
+  for (std::size_t i = 1; i < v.size(); ++i)
+    if (v[i - 1] > v[i]) return false;
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = s21_bench::arg_or(argc, argv, 1, 4000000);
+  const std::size_t threads = s21_bench::arg_or(
+      argc, argv, 2, std::max(1u, std::thread::hardware_concurrency()));
+
+  s21::vector<int> v(n);
+  fill(v);
+  int* data = v.data();
+  const double serial_ms = s21_bench::time_ms([&] {
+    serial_sort(data, data + n);
+  });
+  s21_bench::report("quicksort serial", n, serial_ms);
+  if (!sorted(v)) return 1;
+
+  s21::thread_pool pool(threads);
+  fill(v);
+  const double parallel_ms = s21_bench::time_ms([&] {
+    parallel_sort(pool, data, data + n);
+  });
+  s21_bench::report("quicksort thread_pool", n, parallel_ms);
+  if (!sorted(v)) return 1;
+
+  std::printf("%-40s %10zu threads, %.2fx speedup\n", "thread_pool",
+              pool.size(), serial_ms / parallel_ms);
+  return 0;
+}
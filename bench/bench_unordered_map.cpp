@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "../assoc/s21_map.h"
+#include "../assoc/s21_unordered_map.h"
+#include "bench_common.h"
+
+namespace {
+
+template <class F>
+void run(const char* name, std::size_t ops, F&& f) {
+  long long result = 0;
+  s21_bench::report(name, ops, s21_bench::time_ms([&] { result = f(); }));
+  s21_bench::do_not_optimize(result);
+}
+
+// Random inserts, lookups of present and absent keys, then erasing every
+// key (through find() for s21::map, which has no erase by key); the
+// lookups repeat until about ops have run.
+template <class Map>
+void run_map(const char* label, const std::vector<int>& keys,
+             const std::vector<int>& order, std::size_t ops) {
+  const std::size_t n = keys.size();
+  const std::size_t rounds = std::max<std::size_t>(1, ops / n);
+  char name[64];
+  Map m;
+  std::snprintf(name, sizeof(name), "%s insert", label);
+  run(name, n, [&] {
+    for (int k : keys) m.insert({k, k});
+    return static_cast<long long>(m.size());
+  });
+  std::snprintf(name, sizeof(name), "%s find hit", label);
+  run(name, n * rounds, [&] {
+    long long sum = 0;
+    for (std::size_t r = 0; r < rounds; ++r)
+      for (int k : order) sum += m.find(k)->second;
+    return sum;
+  });
+  std::snprintf(name, sizeof(name), "%s find miss", label);
+  run(name, n * rounds, [&] {
+    long long hits = 0;
+    for (std::size_t r = 0; r < rounds; ++r)
+      for (int k : order) hits += m.find(k + 1) != m.end();
+    return hits;
+  });
+  std::snprintf(name, sizeof(name), "%s erase", label);
+  run(name, n, [&] {
+    for (int k : order) {
+      if constexpr (requires { m.erase(k); })
+        m.erase(k);
+      else
+        m.erase(m.find(k));
+    }
+    return static_cast<long long>(m.size());
+  });
+}
+
+void run_size(std::size_t n) {
+  std::mt19937 rng(11);
+  std::vector<int> keys(n);
+  // Even keys, so k + 1 is a miss that falls between present keys.
+  for (auto& k : keys) k = static_cast<int>((rng() >> 1) & ~1u);
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+  std::shuffle(keys.begin(), keys.end(), rng);
+  std::vector<int> order = keys;
+  std::shuffle(order.begin(), order.end(), rng);
+
+  std::printf("n = %zu\n", keys.size());
+  constexpr std::size_t kOps = 4000000;
+  run_map<s21::unordered_map<int, int>>("s21::unordered_map", keys, order,
+                                        kOps);
+  run_map<std::unordered_map<int, int>>("std::unordered_map", keys, order,
+                                        kOps);
+  run_map<s21::map<int, int>>("s21::map", keys, order, kOps);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc > 1) {
+    run_size(s21_bench::arg_or(argc, argv, 1, 0));
+    return 0;
+  }
+  run_size(1000);
+  run_size(1000000);
+  return 0;
+}
@@ -0,0 +1,65 @@
+#include <cstdio>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "../assoc/s21_multiset.h"
+#include "../assoc/s21_unordered_multiset.h"
+#include "bench_common.h"
+
+namespace {
+
+template <class F>
+void run(const char* name, std::size_t ops, F&& f) {
+  long long result = 0;
+  s21_bench::report(name, ops, s21_bench::time_ms([&] { result = f(); }));
+  s21_bench::do_not_optimize(result);
+}
+
+// Counts a stream of events with a skewed key distribution, then asks how
+// often each distinct key occurred.
+template <class Set>
+void run_set(const char* label, const std::vector<int>& events,
+             int distinct) {
+  char name[64];
+  Set s;
+  std::snprintf(name, sizeof(name), "%s insert", label);
+  run(name, events.size(), [&] {
+    for (int e : events) s.insert(e);
+    return static_cast<long long>(s.size());
+  });
+  std::snprintf(name, sizeof(name), "%s count", label);
+  run(name, static_cast<std::size_t>(distinct), [&] {
+    long long sum = 0;
+    for (int k = 0; k < distinct; ++k) sum += s.count(k);
+    return sum;
+  });
+}
+
+void run_size(std::size_t n, int distinct) {
+  std::mt19937 rng(23);
+  // Geometric-ish skew: a few keys take most of the events.
+  std::geometric_distribution<int> skew(8.0 / distinct);
+  std::vector<int> events(n);
+  for (auto& e : events) e = skew(rng) % distinct;
+
+  std::printf("events = %zu, distinct keys <= %d\n", n, distinct);
+  run_set<s21::unordered_multiset<int>>("s21::unordered_multiset", events,
+                                        distinct);
+  run_set<std::unordered_multiset<int>>("std::unordered_multiset", events,
+                                        distinct);
+  run_set<s21::multiset<int>>("s21::multiset", events, distinct);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc > 1) {
+    run_size(s21_bench::arg_or(argc, argv, 1, 0),
+             static_cast<int>(s21_bench::arg_or(argc, argv, 2, 1000)));
+    return 0;
+  }
+  run_size(1000000, 1000);
+  run_size(1000000, 100000);
+  return 0;
+}
@@ -0,0 +1,228 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <iterator>
+#include <mutex>
+#include <utility>
+
+#include "../seq/s21_ring_buffer.h"
+
+namespace s21 {
+
+// Mutex/condition-variable work channel over a contiguous ring buffer.
+// capacity == 0 means unbounded. After close() pushes fail, waiters wake up
+// and consumers drain what is left before wait_pop reports false.
+template <class T>
+class blocking_queue {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using buffer_type = ring_buffer<T>;
+
+  explicit blocking_queue(size_type capacity = 0) : capacity_(capacity) {
+    if (capacity_ != 0) items_.reserve(capacity_);
+  }
+  blocking_queue(const blocking_queue&) = delete;
+  blocking_queue& operator=(const blocking_queue&) = delete;
+  ~blocking_queue() = default;
+
+  bool push(const_reference value) { return emplace(value); }
+  bool push(value_type&& value) { return emplace(std::move(value)); }
+  template <class... Args>
+  bool emplace(Args&&... args);
+  bool try_push(const_reference value);
+  bool try_push(value_type&& value);
+
+  bool wait_pop(reference out);
+  template <class Rep, class Period>
+  bool wait_pop_for(reference out,
+                    const std::chrono::duration<Rep, Period>& timeout);
+  bool try_pop(reference out);
+
+  template <class InputIt>
+  size_type push_bulk(InputIt first, InputIt last);
+  size_type pop_bulk(value_type* out, size_type max_items);
+  buffer_type pop_all();
+
+  void close();
+  [[nodiscard]] bool closed() const;
+  [[nodiscard]] size_type size() const;
+  [[nodiscard]] bool empty() const { return size() == 0; }
+  [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+
+ private:
+  bool full() const noexcept {
+    return capacity_ != 0 && items_.size() >= capacity_;
+  }
+  void pop_front_into(reference out) {
+    out = std::move(items_.front());
+    items_.pop_front();
+  }
+  template <class V>
+  bool try_push_impl(V&& value);
+
+  mutable std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  buffer_type items_;
+  size_type capacity_ = 0;
+  bool closed_ = false;
+};
+
+template <class T>
+template <class... Args>
+bool blocking_queue<T>::emplace(Args&&... args) {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [this] { return closed_ || !full(); });
+    if (closed_) return false;
+    items_.emplace_back(std::forward<Args>(args)...);
+  }
+  not_empty_.notify_one();
+  return true;
+}
+
+template <class T>
+template <class V>
+bool blocking_queue<T>::try_push_impl(V&& value) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_ || full()) return false;
+    items_.push_back(std::forward<V>(value));
+  }
+  not_empty_.notify_one();
+  return true;
+}
+
+template <class T>
+bool blocking_queue<T>::try_push(const_reference value) {
+  return try_push_impl(value);
+}
+
+template <class T>
+bool blocking_queue<T>::try_push(value_type&& value) {
+  return try_push_impl(std::move(value));
+}
+
+template <class T>
+bool blocking_queue<T>::wait_pop(reference out) {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return closed_ || !items_.empty(); });
+    if (items_.empty()) return false;
+    pop_front_into(out);
+  }
+  if (capacity_ != 0) not_full_.notify_one();
+  return true;
+}
+
+template <class T>
+template <class Rep, class Period>
+bool blocking_queue<T>::wait_pop_for(
+    reference out, const std::chrono::duration<Rep, Period>& timeout) {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!not_empty_.wait_for(lock, timeout,
+                             [this] { return closed_ || !items_.empty(); }) ||
+        items_.empty())
+      return false;
+    pop_front_into(out);
+  }
+  if (capacity_ != 0) not_full_.notify_one();
+  return true;
+}
+
+template <class T>
+bool blocking_queue<T>::try_pop(reference out) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (items_.empty()) return false;
+    pop_front_into(out);
+  }
+  if (capacity_ != 0) not_full_.notify_one();
+  return true;
+}
+
+// Takes the lock once per batch (once per refill when bounded) and wakes
+// consumers once per batch. Returns how many items were enqueued, which is
+// short of the range only if the queue was closed meanwhile.
+template <class T>
+template <class InputIt>
+typename blocking_queue<T>::size_type blocking_queue<T>::push_bulk(
+    InputIt first, InputIt last) {
+  size_type pushed = 0;
+  while (first != last) {
+    size_type batch = 0;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      not_full_.wait(lock, [this] { return closed_ || !full(); });
+      if (closed_) break;
+      for (; first != last && !full(); ++first, ++batch)
+        items_.push_back(*first);
+    }
+    pushed += batch;
+    if (batch == 1)
+      not_empty_.notify_one();
+    else
+      not_empty_.notify_all();
+  }
+  return pushed;
+}
+
+// Waits for at least one item, then moves out up to max_items under one
+// lock. Returns 0 only once the queue is closed and drained, or at once
+// when max_items is 0.
+template <class T>
+typename blocking_queue<T>::size_type blocking_queue<T>::pop_bulk(
+    value_type* out, size_type max_items) {
+  if (max_items == 0) return 0;
+  size_type taken = 0;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return closed_ || !items_.empty(); });
+    taken = items_.pop_front_n(out, max_items);
+  }
+  if (taken != 0 && capacity_ != 0) not_full_.notify_all();
+  return taken;
+}
+
+template <class T>
+typename blocking_queue<T>::buffer_type blocking_queue<T>::pop_all() {
+  // A bounded queue keeps its up-front reservation; the allocation happens
+  // before taking the lock.
+  buffer_type drained;
+  if (capacity_ != 0) drained.reserve(capacity_);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    drained.swap(items_);
+  }
+  if (capacity_ != 0) not_full_.notify_all();
+  return drained;
+}
+
+template <class T>
+void blocking_queue<T>::close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+  }
+  not_empty_.notify_all();
+  not_full_.notify_all();
+}
+
+template <class T>
+bool blocking_queue<T>::closed() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return closed_;
+}
+
+template <class T>
+typename blocking_queue<T>::size_type blocking_queue<T>::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return items_.size();
+}
+
+}  // namespace s21
@@ -0,0 +1,469 @@
+#pragma once
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+#include "s21_epoch.h"
+#include "s21_sync_utils.h"
+
+namespace s21 {
+
+// Ordered map for many threads without external locking: a lock-free skip
+// list in the style of Fraser and Herlihy-Shavit. Every level is a sorted
+// list whose next pointers carry a "deleted" mark in the low bit; erase
+// marks a node top-down and the thread that marks level 0 owns the
+// removal. Any thread that walks past a marked node unlinks it, and an
+// unlinked node is retired through the global epoch domain, so readers
+// never take a lock or touch freed memory.
+//
+// Values are not modified in place: replace one by erase and insert.
+// Iterators are weakly consistent. They visit keys in ascending order and
+// see every key present for the whole walk; keys inserted or erased
+// meanwhile may or may not show up. An iterator pins the epoch of the
+// thread that made it until it reaches end() or is destroyed, so it must
+// stay on that thread, and holding one for long delays reclamation.
+template <class Key, class T, class Compare = std::less<Key>>
+class concurrent_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+  using reference = const value_type&;
+  using const_reference = const value_type&;
+
+ private:
+  using Link = std::atomic<std::uintptr_t>;
+
+  // Allocated together with its height links right after it. The head
+  // node has kMaxHeight links and no value.
+  struct Node {
+    explicit Node(unsigned h) noexcept : height(h) {}
+
+    value_type* value_ptr() noexcept {
+      return reinterpret_cast<value_type*>(storage);
+    }
+    value_type& value() noexcept { return *std::launder(value_ptr()); }
+    const key_type& key() noexcept { return value().first; }
+    Link* next() noexcept {
+      return std::launder(reinterpret_cast<Link*>(this + 1));
+    }
+
+    alignas(Link) const unsigned height;
+    // The inserter and the eraser each drop one; the last one retires.
+    std::atomic<int> owners{2};
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+  };
+
+  // Each extra level with probability 1/4 supports about 4^16 keys.
+  static constexpr unsigned kMaxHeight = 16;
+  static constexpr bool kOverAligned =
+      alignof(Node) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+ public:
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename concurrent_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+    const_iterator() = default;
+    const_iterator(const const_iterator& other) : const_iterator(other.node_) {}
+    const_iterator& operator=(const const_iterator& other) {
+      if (other.node_ && !pinned_) pinned_.emplace(epoch_domain::global());
+      node_ = other.node_;
+      if (!node_) pinned_.reset();
+      return *this;
+    }
+    ~const_iterator() = default;
+
+    reference operator*() const noexcept { return node_->value(); }
+    pointer operator->() const noexcept { return &node_->value(); }
+
+    bool operator==(const const_iterator& o) const noexcept {
+      return node_ == o.node_;
+    }
+
+    const_iterator& operator++() noexcept {
+      node_ = first_live(
+          ptr(node_->next()[0].load(std::memory_order_acquire)));
+      if (!node_) pinned_.reset();
+      return *this;
+    }
+    const_iterator operator++(int) {
+      const_iterator t(*this);
+      ++(*this);
+      return t;
+    }
+
+   private:
+    friend class concurrent_map;
+
+    // Called while the caller is pinned, so node is still allocated.
+    explicit const_iterator(Node* node) : node_(node) {
+      if (node_) pinned_.emplace(epoch_domain::global());
+    }
+
+    Node* node_ = nullptr;
+    std::optional<epoch_domain::guard> pinned_;
+  };
+  using iterator = const_iterator;
+
+  concurrent_map() : concurrent_map(Compare()) {}
+  explicit concurrent_map(const Compare& comp)
+      : head_(make_node(kMaxHeight)), comp_(comp) {}
+  concurrent_map(const concurrent_map&) = delete;
+  concurrent_map& operator=(const concurrent_map&) = delete;
+  // Requires that no other thread still uses the map.
+  ~concurrent_map();
+
+  const_iterator begin() const;
+  const_iterator end() const noexcept { return const_iterator(); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  [[nodiscard]] bool empty() const { return begin() == end(); }
+  // Walks the whole list: O(n), and only a snapshot under concurrent
+  // writes.
+  size_type size() const;
+
+  // Each returns false, leaving the map unchanged, when key is present.
+  bool insert(const value_type& value) {
+    return try_emplace(value.first, value.second);
+  }
+  bool insert(value_type&& value) {
+    return try_emplace(value.first, std::move(value.second));
+  }
+  bool insert(const key_type& key, const mapped_type& obj) {
+    return try_emplace(key, obj);
+  }
+  // The value is only built once key has been found absent.
+  template <class... Args>
+  bool try_emplace(const key_type& key, Args&&... args);
+
+  // True when this call removed key, false when key was absent or another
+  // erase got it first.
+  bool erase(const key_type& key);
+
+  const_iterator find(const key_type& key) const;
+  bool contains(const key_type& key) const;
+  // First key not less than key.
+  const_iterator lower_bound(const key_type& key) const;
+
+  key_compare key_comp() const { return comp_; }
+
+ private:
+  static Node* ptr(std::uintptr_t link) noexcept {
+    return reinterpret_cast<Node*>(link & ~std::uintptr_t{1});
+  }
+  static bool marked(std::uintptr_t link) noexcept { return link & 1u; }
+  static std::uintptr_t link_to(Node* node) noexcept {
+    return reinterpret_cast<std::uintptr_t>(node);
+  }
+
+  static Node* make_node(unsigned height);
+  static void free_node(Node* node) noexcept;
+  static void destroy_node(void* node) noexcept;
+  static unsigned random_height() noexcept;
+
+  // The first node from node on that is not erased at level 0.
+  static Node* first_live(Node* node) noexcept;
+
+  // Fills preds and succs with, on every level, the last node before key
+  // and the one after it, unlinking erased nodes on the way; true when
+  // succs[0] holds key.
+  bool locate(const key_type& key, Node** preds, Node** succs) const;
+  bool try_locate(const key_type& key, Node** preds, Node** succs) const;
+  // Read-only descent: the first live node with a key not less than key.
+  Node* seek(const key_type& key) const;
+  // Links an inserted node on its levels above 0, giving up on the rest
+  // once it is being erased.
+  void link_upper(Node* node, Node** preds, Node** succs) const;
+  void release(Node* node) const;
+
+  Node* const head_;
+  [[no_unique_address]] Compare comp_;
+};
+
+template <class Key, class T, class Compare>
+concurrent_map<Key, T, Compare>::~concurrent_map() {
+  Node* node = ptr(head_->next()[0].load(std::memory_order_acquire));
+  while (node) {
+    Node* next = ptr(node->next()[0].load(std::memory_order_relaxed));
+    destroy_node(node);
+    node = next;
+  }
+  free_node(head_);
+}
+
+template <class Key, class T, class Compare>
+typename concurrent_map<Key, T, Compare>::Node*
+concurrent_map<Key, T, Compare>::make_node(unsigned height) {
+  const std::size_t bytes = sizeof(Node) + height * sizeof(Link);
+  void* raw = kOverAligned
+                  ? ::operator new(bytes, std::align_val_t{alignof(Node)})
+                  : ::operator new(bytes);
+  Node* node = std::construct_at(static_cast<Node*>(raw), height);
+  Link* links = reinterpret_cast<Link*>(node + 1);
+  for (unsigned i = 0; i < height; ++i) std::construct_at(links + i, 0);
+  return node;
+}
+
+template <class Key, class T, class Compare>
+void concurrent_map<Key, T, Compare>::free_node(Node* node) noexcept {
+  // Links and Node itself are trivially destructible.
+  if constexpr (kOverAligned)
+    ::operator delete(node, std::align_val_t{alignof(Node)});
+  else
+    ::operator delete(node);
+}
+
+template <class Key, class T, class Compare>
+void concurrent_map<Key, T, Compare>::destroy_node(void* node) noexcept {
+  Node* n = static_cast<Node*>(node);
+  std::destroy_at(&n->value());
+  free_node(n);
+}
+
+template <class Key, class T, class Compare>
+unsigned concurrent_map<Key, T, Compare>::random_height() noexcept {
+  static thread_local std::uint64_t state = 0;
+  if (state == 0)
+    state = (reinterpret_cast<std::uintptr_t>(&state) | 1) *
+            0x9E3779B97F4A7C15ull;
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  // Two random bits per level; the fixed bit caps the height.
+  const std::uint64_t bits = state | (std::uint64_t{1} << (2 * kMaxHeight - 2));
+  return 1 + static_cast<unsigned>(std::countr_zero(bits)) / 2;
+}
+
+template <class Key, class T, class Compare>
+typename concurrent_map<Key, T, Compare>::Node*
+concurrent_map<Key, T, Compare>::first_live(Node* node) noexcept {
+  while (node) {
+    const std::uintptr_t next = node->next()[0].load(std::memory_order_acquire);
+    if (!marked(next)) return node;
+    node = ptr(next);
+  }
+  return nullptr;
+}
+
+template <class Key, class T, class Compare>
+bool concurrent_map<Key, T, Compare>::try_locate(const key_type& key,
+                                                 Node** preds,
+                                                 Node** succs) const {
+  Node* pred = head_;
+  for (unsigned level = kMaxHeight; level-- > 0;) {
+    Node* curr = ptr(pred->next()[level].load(std::memory_order_acquire));
+    while (curr) {
+      const std::uintptr_t succ =
+          curr->next()[level].load(std::memory_order_acquire);
+      if (marked(succ)) {
+        // curr is being erased: unlink it here. Failing means pred changed
+        // or is being erased too, so start over from the head.
+        std::uintptr_t expected = link_to(curr);
+        if (!pred->next()[level].compare_exchange_strong(
+                expected, link_to(ptr(succ)), std::memory_order_acq_rel,
+                std::memory_order_acquire))
+          return false;
+        curr = ptr(succ);
+        continue;
+      }
+      if (!comp_(curr->key(), key)) break;
+      pred = curr;
+      curr = ptr(succ);
+    }
+    preds[level] = pred;
+    succs[level] = curr;
+  }
+  return true;
+}
+
+template <class Key, class T, class Compare>
+bool concurrent_map<Key, T, Compare>::locate(const key_type& key,
+                                             Node** preds,
+                                             Node** succs) const {
+  backoff spin;
+  while (!try_locate(key, preds, succs)) spin.pause();
+  return succs[0] && !comp_(key, succs[0]->key());
+}
+
+template <class Key, class T, class Compare>
+typename concurrent_map<Key, T, Compare>::Node*
+concurrent_map<Key, T, Compare>::seek(const key_type& key) const {
+  Node* pred = head_;
+  Node* curr = nullptr;
+  for (unsigned level = kMaxHeight; level-- > 0;) {
+    curr = ptr(pred->next()[level].load(std::memory_order_acquire));
+    while (curr) {
+      const std::uintptr_t succ =
+          curr->next()[level].load(std::memory_order_acquire);
+      // A marked link is frozen and still leads forward.
+      if (!marked(succ)) {
+        if (!comp_(curr->key(), key)) break;
+        pred = curr;
+      }
+      curr = ptr(succ);
+    }
+  }
+  return curr;
+}
+
+template <class Key, class T, class Compare>
+void concurrent_map<Key, T, Compare>::link_upper(Node* node, Node** preds,
+                                                 Node** succs) const {
+  for (unsigned i = 1; i < node->height; ++i) {
+    for (;;) {
+      std::uintptr_t next = node->next()[i].load(std::memory_order_acquire);
+      // Once erase has marked a level the node must not be linked there.
+      if (marked(next)) return;
+      if (ptr(next) != succs[i] &&
+          !node->next()[i].compare_exchange_strong(
+              next, link_to(succs[i]), std::memory_order_acq_rel,
+              std::memory_order_acquire))
+        return;
+      std::uintptr_t expected = link_to(succs[i]);
+      if (preds[i]->next()[i].compare_exchange_strong(
+              expected, link_to(node), std::memory_order_release,
+              std::memory_order_relaxed))
+        break;
+      if (!locate(node->key(), preds, succs) || succs[0] != node) return;
+    }
+  }
+}
+
+template <class Key, class T, class Compare>
+void concurrent_map<Key, T, Compare>::release(Node* node) const {
+  if (node->owners.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    epoch_domain::global().retire(node, &destroy_node);
+}
+
+template <class Key, class T, class Compare>
+template <class... Args>
+bool concurrent_map<Key, T, Compare>::try_emplace(const key_type& key,
+                                                  Args&&... args) {
+  epoch_domain::guard pinned(epoch_domain::global());
+  Node* preds[kMaxHeight];
+  Node* succs[kMaxHeight];
+  if (locate(key, preds, succs)) return false;
+
+  const unsigned height = random_height();
+  Node* node = make_node(height);
+  try {
+    std::construct_at(node->value_ptr(), std::piecewise_construct,
+                      std::forward_as_tuple(key),
+                      std::forward_as_tuple(std::forward<Args>(args)...));
+  } catch (...) {
+    free_node(node);
+    throw;
+  }
+
+  // Linking level 0 is the insertion; the upper levels are shortcuts.
+  for (;;) {
+    for (unsigned i = 0; i < height; ++i)
+      node->next()[i].store(link_to(succs[i]), std::memory_order_relaxed);
+    std::uintptr_t expected = link_to(succs[0]);
+    if (preds[0]->next()[0].compare_exchange_strong(
+            expected, link_to(node), std::memory_order_release,
+            std::memory_order_relaxed))
+      break;
+    if (locate(key, preds, succs)) {
+      // Never published, so nobody else can hold it.
+      destroy_node(node);
+      return false;
+    }
+  }
+
+  link_upper(node, preds, succs);
+  // An erase that finished before the last link above could not unlink
+  // it; do that here.
+  if (marked(node->next()[0].load(std::memory_order_acquire)))
+    locate(key, preds, succs);
+  release(node);
+  return true;
+}
+
+template <class Key, class T, class Compare>
+bool concurrent_map<Key, T, Compare>::erase(const key_type& key) {
+  epoch_domain::guard pinned(epoch_domain::global());
+  Node* preds[kMaxHeight];
+  Node* succs[kMaxHeight];
+  if (!locate(key, preds, succs)) return false;
+  Node* node = succs[0];
+
+  for (unsigned i = node->height; i-- > 1;) {
+    std::uintptr_t next = node->next()[i].load(std::memory_order_relaxed);
+    while (!marked(next) &&
+           !node->next()[i].compare_exchange_weak(next, next | 1u,
+                                                  std::memory_order_acq_rel,
+                                                  std::memory_order_relaxed)) {
+    }
+  }
+  std::uintptr_t next = node->next()[0].load(std::memory_order_relaxed);
+  do {
+    if (marked(next)) return false;
+  } while (!node->next()[0].compare_exchange_weak(next, next | 1u,
+                                                  std::memory_order_acq_rel,
+                                                  std::memory_order_relaxed));
+  locate(key, preds, succs);
+  release(node);
+  return true;
+}
+
+template <class Key, class T, class Compare>
+typename concurrent_map<Key, T, Compare>::const_iterator
+concurrent_map<Key, T, Compare>::begin() const {
+  epoch_domain::guard pinned(epoch_domain::global());
+  return const_iterator(
+      first_live(ptr(head_->next()[0].load(std::memory_order_acquire))));
+}
+
+template <class Key, class T, class Compare>
+typename concurrent_map<Key, T, Compare>::size_type
+concurrent_map<Key, T, Compare>::size() const {
+  epoch_domain::guard pinned(epoch_domain::global());
+  size_type n = 0;
+  Node* node = head_;
+  while ((node = first_live(
+              ptr(node->next()[0].load(std::memory_order_acquire)))))
+    ++n;
+  return n;
+}
+
+template <class Key, class T, class Compare>
+typename concurrent_map<Key, T, Compare>::const_iterator
+concurrent_map<Key, T, Compare>::find(const key_type& key) const {
+  epoch_domain::guard pinned(epoch_domain::global());
+  Node* node = seek(key);
+  if (node && comp_(key, node->key())) node = nullptr;
+  return const_iterator(node);
+}
+
+template <class Key, class T, class Compare>
+bool concurrent_map<Key, T, Compare>::contains(const key_type& key) const {
+  epoch_domain::guard pinned(epoch_domain::global());
+  Node* node = seek(key);
+  return node && !comp_(key, node->key());
+}
+
+template <class Key, class T, class Compare>
+typename concurrent_map<Key, T, Compare>::const_iterator
+concurrent_map<Key, T, Compare>::lower_bound(const key_type& key) const {
+  epoch_domain::guard pinned(epoch_domain::global());
+  return const_iterator(seek(key));
+}
+
+}  // namespace s21
@@ -0,0 +1,201 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+#include "../seq/s21_vector.h"
+#include "s21_sync_utils.h"
+
+namespace s21 {
+
+// Epoch-based memory reclamation for lock-free structures. A thread pins
+// itself (epoch_domain::guard) before dereferencing shared nodes; an
+// unlinked node is retire()d instead of deleted and freed once every pinned
+// thread has observed two epoch advances since, so no reader can still
+// hold a pointer to it. Threads register lazily; their records are reused
+// after they exit and leftover garbage is handed to the domain.
+class epoch_domain {
+ public:
+  class guard {
+   public:
+    explicit guard(epoch_domain& domain) : domain_(&domain) { domain_->pin(); }
+    guard(const guard&) = delete;
+    guard& operator=(const guard&) = delete;
+    ~guard() { domain_->unpin(); }
+
+   private:
+    epoch_domain* domain_;
+  };
+
+  epoch_domain(const epoch_domain&) = delete;
+  epoch_domain& operator=(const epoch_domain&) = delete;
+  ~epoch_domain();
+
+  // The single process-wide domain shared by all s21 lock-free containers;
+  // each thread caches its record in a thread_local slot.
+  static epoch_domain& global() {
+    static epoch_domain domain;
+    return domain;
+  }
+
+  template <class T>
+  void retire(T* ptr) {
+    retire(ptr, [](void* p) { delete static_cast<T*>(p); });
+  }
+  void retire(void* ptr, void (*deleter)(void*));
+
+  // Tries to advance the epoch and frees whatever became safe.
+  void collect();
+
+  [[nodiscard]] std::uint64_t epoch() const noexcept {
+    return epoch_.load(std::memory_order_acquire);
+  }
+
+ private:
+  epoch_domain() = default;
+
+  struct Retired {
+    void* ptr;
+    void (*deleter)(void*);
+    std::uint64_t epoch;
+  };
+
+  struct alignas(kCacheLineSize) Record {
+    // (epoch << 1) | pinned
+    std::atomic<std::uint64_t> state{0};
+    std::atomic<bool> owned{true};
+    Record* next = nullptr;
+    unsigned nesting = 0;
+    vector<Retired> garbage;
+  };
+
+  // Releases the calling thread's record when the thread exits.
+  struct ThreadSlot {
+    epoch_domain* domain = nullptr;
+    Record* record = nullptr;
+    ~ThreadSlot() {
+      if (record) domain->release(record);
+    }
+  };
+
+  static constexpr std::size_t kCollectThreshold = 64;
+
+  Record* local_record();
+  Record* acquire_record();
+  void release(Record* rec);
+  void pin();
+  void unpin();
+  bool try_advance();
+  static void free_expired(vector<Retired>& list, std::uint64_t safe_before);
+
+  alignas(kCacheLineSize) std::atomic<std::uint64_t> epoch_{2};
+  std::atomic<Record*> records_{nullptr};
+  std::mutex orphans_mutex_;
+  vector<Retired> orphans_;
+};
+
+inline epoch_domain::~epoch_domain() {
+  Record* rec = records_.load(std::memory_order_acquire);
+  while (rec) {
+    for (const Retired& r : rec->garbage) r.deleter(r.ptr);
+    Record* next = rec->next;
+    delete rec;
+    rec = next;
+  }
+  for (const Retired& r : orphans_) r.deleter(r.ptr);
+}
+
+inline epoch_domain::Record* epoch_domain::local_record() {
+  static thread_local ThreadSlot slot;
+  if (!slot.record) {
+    slot.domain = this;
+    slot.record = acquire_record();
+  }
+  return slot.record;
+}
+
+inline epoch_domain::Record* epoch_domain::acquire_record() {
+  for (Record* rec = records_.load(std::memory_order_acquire); rec;
+       rec = rec->next) {
+    bool expected = false;
+    if (!rec->owned.load(std::memory_order_relaxed) &&
+        rec->owned.compare_exchange_strong(expected, true,
+                                           std::memory_order_acquire))
+      return rec;
+  }
+  Record* rec = new Record;
+  Record* head = records_.load(std::memory_order_relaxed);
+  do {
+    rec->next = head;
+  } while (!records_.compare_exchange_weak(head, rec,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed));
+  return rec;
+}
+
+inline void epoch_domain::release(Record* rec) {
+  if (!rec->garbage.empty()) {
+    std::lock_guard<std::mutex> lock(orphans_mutex_);
+    for (const Retired& r : rec->garbage) orphans_.push_back(r);
+    rec->garbage.clear();
+  }
+  rec->state.store(0, std::memory_order_release);
+  rec->owned.store(false, std::memory_order_release);
+}
+
+inline void epoch_domain::pin() {
+  Record* rec = local_record();
+  if (rec->nesting++ != 0) return;
+  const std::uint64_t e = epoch_.load(std::memory_order_relaxed);
+  rec->state.store((e << 1) | 1u, std::memory_order_relaxed);
+  // The announcement must be visible before any shared pointer is read.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+inline void epoch_domain::unpin() {
+  Record* rec = local_record();
+  if (--rec->nesting != 0) return;
+  rec->state.store(0, std::memory_order_release);
+}
+
+inline bool epoch_domain::try_advance() {
+  std::uint64_t e = epoch_.load(std::memory_order_seq_cst);
+  for (Record* rec = records_.load(std::memory_order_acquire); rec;
+       rec = rec->next) {
+    const std::uint64_t s = rec->state.load(std::memory_order_seq_cst);
+    if ((s & 1u) && (s >> 1) != e) return false;
+  }
+  return epoch_.compare_exchange_strong(e, e + 1, std::memory_order_seq_cst);
+}
+
+inline void epoch_domain::free_expired(vector<Retired>& list,
+                                       std::uint64_t safe_before) {
+  std::size_t kept = 0;
+  for (std::size_t i = 0; i < list.size(); ++i) {
+    if (list[i].epoch < safe_before)
+      list[i].deleter(list[i].ptr);
+    else
+      list[kept++] = list[i];
+  }
+  while (list.size() > kept) list.pop_back();
+}
+
+inline void epoch_domain::retire(void* ptr, void (*deleter)(void*)) {
+  Record* rec = local_record();
+  rec->garbage.push_back(
+      Retired{ptr, deleter, epoch_.load(std::memory_order_seq_cst)});
+  if (rec->garbage.size() >= kCollectThreshold) collect();
+}
+
+inline void epoch_domain::collect() {
+  try_advance();
+  // Anything retired two epochs ago cannot be referenced by a pinned thread.
+  const std::uint64_t safe_before = epoch_.load(std::memory_order_acquire) - 1;
+  free_expired(local_record()->garbage, safe_before);
+  std::unique_lock<std::mutex> lock(orphans_mutex_, std::try_to_lock);
+  if (lock.owns_lock()) free_expired(orphans_, safe_before);
+}
+
+}  // namespace s21
@@ -0,0 +1,136 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "../seq/s21_ring_buffer.h"
+#include "s21_epoch.h"
+#include "s21_sync_utils.h"
+
+namespace s21 {
+
+// Unbounded Treiber stack. The head is a single word holding the top node
+// pointer and a modification tag in the unused upper bits, so every CAS
+// sees a fresh value even if the same address comes back. Popped nodes are
+// retired through the global epoch domain rather than deleted, which keeps
+// a concurrent pop from reading a node that another thread already freed.
+template <class T>
+class lockfree_stack {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using buffer_type = ring_buffer<T>;
+
+  lockfree_stack() = default;
+  lockfree_stack(const lockfree_stack&) = delete;
+  lockfree_stack& operator=(const lockfree_stack&) = delete;
+  ~lockfree_stack();
+
+  void push(const_reference value) { emplace(value); }
+  void push(value_type&& value) { emplace(std::move(value)); }
+  template <class... Args>
+  void emplace(Args&&... args);
+  bool try_pop(reference out);
+  // Detaches the whole stack with one exchange; the result is in pop order.
+  buffer_type pop_all();
+
+  [[nodiscard]] bool empty() const noexcept {
+    return node_of(head_.load(std::memory_order_acquire)) == nullptr;
+  }
+
+ private:
+  struct Node {
+    value_type value;
+    Node* next;
+  };
+
+  // x86-64 and AArch64 user-space pointers fit in 48 bits.
+  static constexpr unsigned kPtrBits = sizeof(void*) == 8 ? 48 : 32;
+  static constexpr std::uint64_t kPtrMask =
+      (std::uint64_t{1} << kPtrBits) - 1;
+
+  static Node* node_of(std::uint64_t word) noexcept {
+    return reinterpret_cast<Node*>(
+        static_cast<std::uintptr_t>(word & kPtrMask));
+  }
+  static std::uint64_t tag_of(std::uint64_t word) noexcept {
+    return word >> kPtrBits;
+  }
+  static std::uint64_t pack(Node* node, std::uint64_t tag) noexcept {
+    return (tag << kPtrBits) | reinterpret_cast<std::uintptr_t>(node);
+  }
+
+  alignas(kCacheLineSize) std::atomic<std::uint64_t> head_{0};
+};
+
+template <class T>
+lockfree_stack<T>::~lockfree_stack() {
+  Node* node = node_of(head_.load(std::memory_order_relaxed));
+  while (node) {
+    Node* next = node->next;
+    delete node;
+    node = next;
+  }
+}
+
+template <class T>
+template <class... Args>
+void lockfree_stack<T>::emplace(Args&&... args) {
+  Node* node = new Node{value_type(std::forward<Args>(args)...), nullptr};
+  std::uint64_t old = head_.load(std::memory_order_relaxed);
+  backoff spin;
+  for (;;) {
+    node->next = node_of(old);
+    if (head_.compare_exchange_weak(old, pack(node, tag_of(old) + 1),
+                                    std::memory_order_release,
+                                    std::memory_order_relaxed))
+      return;
+    spin.pause();
+  }
+}
+
+template <class T>
+bool lockfree_stack<T>::try_pop(reference out) {
+  epoch_domain& domain = epoch_domain::global();
+  Node* node = nullptr;
+  {
+    epoch_domain::guard pinned(domain);
+    std::uint64_t old = head_.load(std::memory_order_acquire);
+    backoff spin;
+    for (;;) {
+      node = node_of(old);
+      if (!node) return false;
+      if (head_.compare_exchange_weak(old, pack(node->next, tag_of(old) + 1),
+                                      std::memory_order_acquire,
+                                      std::memory_order_acquire))
+        break;
+      spin.pause();
+    }
+  }
+  out = std::move(node->value);
+  domain.retire(node);
+  return true;
+}
+
+template <class T>
+typename lockfree_stack<T>::buffer_type lockfree_stack<T>::pop_all() {
+  buffer_type items;
+  std::uint64_t old = head_.load(std::memory_order_relaxed);
+  while (!head_.compare_exchange_weak(old, pack(nullptr, tag_of(old) + 1),
+                                      std::memory_order_acquire,
+                                      std::memory_order_relaxed)) {
+  }
+  epoch_domain& domain = epoch_domain::global();
+  for (Node* node = node_of(old); node;) {
+    Node* next = node->next;
+    items.push_back(std::move(node->value));
+    domain.retire(node);
+    node = next;
+  }
+  return items;
+}
+
+}  // namespace s21
@@ -0,0 +1,157 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_sync_utils.h"
+
+namespace s21 {
+
+// Bounded multi-producer/multi-consumer array queue (Vyukov). Every cell
+// carries a sequence number that tells producers and consumers whether the
+// cell is free for the current lap, so the only shared writes are one CAS on
+// the enqueue or dequeue position. No allocation happens after construction.
+template <class T>
+class mpmc_queue {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+
+  explicit mpmc_queue(size_type capacity);
+  mpmc_queue(const mpmc_queue&) = delete;
+  mpmc_queue& operator=(const mpmc_queue&) = delete;
+  ~mpmc_queue() noexcept;
+
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type&& value) { return try_emplace(std::move(value)); }
+  template <class... Args>
+  bool try_emplace(Args&&... args);
+  bool try_pop(reference out);
+
+  void push(const_reference value) { emplace(value); }
+  void push(value_type&& value) { emplace(std::move(value)); }
+  template <class... Args>
+  void emplace(Args&&... args);
+  void pop(reference out);
+
+  [[nodiscard]] size_type capacity() const noexcept { return mask_ + 1; }
+  [[nodiscard]] size_type size_approx() const noexcept;
+  [[nodiscard]] bool empty() const noexcept { return size_approx() == 0; }
+
+ private:
+  struct Cell {
+    std::atomic<size_type> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T* value() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+  };
+
+  Cell* cells_ = nullptr;
+  size_type mask_ = 0;
+
+  alignas(kCacheLineSize) std::atomic<size_type> enqueue_pos_{0};
+  alignas(kCacheLineSize) std::atomic<size_type> dequeue_pos_{0};
+};
+
+template <class T>
+mpmc_queue<T>::mpmc_queue(size_type capacity) {
+  if (capacity < 2)
+    throw std::invalid_argument("s21::mpmc_queue: capacity must be at least 2");
+  size_type cap = 1;
+  while (cap < capacity) cap <<= 1;
+  cells_ = std::allocator<Cell>().allocate(cap);
+  for (size_type i = 0; i < cap; ++i) {
+    std::construct_at(cells_ + i);
+    cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  mask_ = cap - 1;
+}
+
+template <class T>
+mpmc_queue<T>::~mpmc_queue() noexcept {
+  const size_type tail = enqueue_pos_.load(std::memory_order_relaxed);
+  for (size_type i = dequeue_pos_.load(std::memory_order_relaxed); i != tail;
+       ++i) {
+    std::destroy_at(cells_[i & mask_].value());
+  }
+  for (size_type i = 0; i <= mask_; ++i) std::destroy_at(cells_ + i);
+  std::allocator<Cell>().deallocate(cells_, mask_ + 1);
+}
+
+template <class T>
+template <class... Args>
+bool mpmc_queue<T>::try_emplace(Args&&... args) {
+  size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+  Cell* cell;
+  for (;;) {
+    cell = &cells_[pos & mask_];
+    const size_type seq = cell->sequence.load(std::memory_order_acquire);
+    const auto diff =
+        static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+    if (diff == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed))
+        break;
+    } else if (diff < 0) {
+      return false;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  std::construct_at(cell->value(), std::forward<Args>(args)...);
+  cell->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+template <class T>
+bool mpmc_queue<T>::try_pop(reference out) {
+  size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+  Cell* cell;
+  for (;;) {
+    cell = &cells_[pos & mask_];
+    const size_type seq = cell->sequence.load(std::memory_order_acquire);
+    const auto diff = static_cast<std::ptrdiff_t>(seq) -
+                      static_cast<std::ptrdiff_t>(pos + 1);
+    if (diff == 0) {
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed))
+        break;
+    } else if (diff < 0) {
+      return false;
+    } else {
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  T* src = cell->value();
+  out = std::move(*src);
+  std::destroy_at(src);
+  cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+  return true;
+}
+
+template <class T>
+template <class... Args>
+void mpmc_queue<T>::emplace(Args&&... args) {
+  backoff wait;
+  while (!try_emplace(std::forward<Args>(args)...)) wait.pause();
+}
+
+template <class T>
+void mpmc_queue<T>::pop(reference out) {
+  backoff wait;
+  while (!try_pop(out)) wait.pause();
+}
+
+template <class T>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::size_approx() const noexcept {
+  const size_type head = dequeue_pos_.load(std::memory_order_acquire);
+  const size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+  return tail >= head ? tail - head : 0;
+}
+
+}  // namespace s21
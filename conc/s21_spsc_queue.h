@@ -0,0 +1,145 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_sync_utils.h"
+
+namespace s21 {
+
+// Bounded wait-free queue for exactly one producer thread and one consumer
+// thread. Each side keeps a private copy of the other side's index and only
+// reloads the shared atomic when the copy says the ring is full/empty.
+template <class T>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+
+  explicit spsc_queue(size_type capacity);
+  spsc_queue(const spsc_queue&) = delete;
+  spsc_queue& operator=(const spsc_queue&) = delete;
+  ~spsc_queue() noexcept;
+
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type&& value) { return try_emplace(std::move(value)); }
+  template <class... Args>
+  bool try_emplace(Args&&... args);
+  bool try_pop(reference out);
+
+  size_type push_n(const value_type* src, size_type n);
+  size_type pop_n(value_type* out, size_type n);
+
+  [[nodiscard]] size_type capacity() const noexcept { return mask_ + 1; }
+  [[nodiscard]] size_type size_approx() const noexcept;
+  [[nodiscard]] bool empty() const noexcept { return size_approx() == 0; }
+
+ private:
+  value_type* slot(size_type index) const noexcept {
+    return slots_ + (index & mask_);
+  }
+
+  value_type* slots_ = nullptr;
+  size_type mask_ = 0;
+
+  alignas(kCacheLineSize) std::atomic<size_type> head_{0};
+  size_type cached_tail_ = 0;
+
+  alignas(kCacheLineSize) std::atomic<size_type> tail_{0};
+  size_type cached_head_ = 0;
+};
+
+template <class T>
+spsc_queue<T>::spsc_queue(size_type capacity) {
+  if (capacity == 0)
+    throw std::invalid_argument("s21::spsc_queue: capacity must be positive");
+  size_type cap = 1;
+  while (cap < capacity) cap <<= 1;
+  slots_ = std::allocator<T>().allocate(cap);
+  mask_ = cap - 1;
+}
+
+template <class T>
+spsc_queue<T>::~spsc_queue() noexcept {
+  const size_type tail = tail_.load(std::memory_order_relaxed);
+  for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+    std::destroy_at(slot(i));
+  }
+  std::allocator<T>().deallocate(slots_, mask_ + 1);
+}
+
+template <class T>
+template <class... Args>
+bool spsc_queue<T>::try_emplace(Args&&... args) {
+  const size_type tail = tail_.load(std::memory_order_relaxed);
+  if (tail - cached_head_ > mask_) {
+    cached_head_ = head_.load(std::memory_order_acquire);
+    if (tail - cached_head_ > mask_) return false;
+  }
+  std::construct_at(slot(tail), std::forward<Args>(args)...);
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+template <class T>
+bool spsc_queue<T>::try_pop(reference out) {
+  const size_type head = head_.load(std::memory_order_relaxed);
+  if (head == cached_tail_) {
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+    if (head == cached_tail_) return false;
+  }
+  value_type* src = slot(head);
+  out = std::move(*src);
+  std::destroy_at(src);
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+// Batch variants publish the whole batch with a single release store.
+template <class T>
+typename spsc_queue<T>::size_type spsc_queue<T>::push_n(const value_type* src,
+                                                        size_type n) {
+  const size_type tail = tail_.load(std::memory_order_relaxed);
+  size_type free_slots = capacity() - (tail - cached_head_);
+  if (free_slots < n) {
+    cached_head_ = head_.load(std::memory_order_acquire);
+    free_slots = capacity() - (tail - cached_head_);
+  }
+  n = std::min(n, free_slots);
+  for (size_type i = 0; i < n; ++i) std::construct_at(slot(tail + i), src[i]);
+  if (n != 0) tail_.store(tail + n, std::memory_order_release);
+  return n;
+}
+
+template <class T>
+typename spsc_queue<T>::size_type spsc_queue<T>::pop_n(value_type* out,
+                                                       size_type n) {
+  const size_type head = head_.load(std::memory_order_relaxed);
+  size_type available = cached_tail_ - head;
+  if (available < n) {
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+    available = cached_tail_ - head;
+  }
+  n = std::min(n, available);
+  for (size_type i = 0; i < n; ++i) {
+    value_type* src = slot(head + i);
+    out[i] = std::move(*src);
+    std::destroy_at(src);
+  }
+  if (n != 0) head_.store(head + n, std::memory_order_release);
+  return n;
+}
+
+template <class T>
+typename spsc_queue<T>::size_type spsc_queue<T>::size_approx() const noexcept {
+  const size_type head = head_.load(std::memory_order_acquire);
+  const size_type tail = tail_.load(std::memory_order_acquire);
+  return tail >= head ? tail - head : 0;
+}
+
+}  // namespace s21
@@ -0,0 +1,41 @@
+#pragma once
+#include <cstddef>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace s21 {
+
+inline constexpr std::size_t kCacheLineSize = 64;
+
+// Exponential spin-then-yield backoff for retry loops on contended atomics.
+class backoff {
+ public:
+  void pause() noexcept {
+    if (spins_ <= kSpinLimit) {
+      for (unsigned i = 0; i < (1u << spins_); ++i) cpu_relax();
+      ++spins_;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+  void reset() noexcept { spins_ = 0; }
+
+ private:
+  static constexpr unsigned kSpinLimit = 6;
+
+  static void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+  }
+
+  unsigned spins_ = 0;
+};
+
+}  // namespace s21
@@ -0,0 +1,292 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "../seq/s21_ring_buffer.h"
+#include "../seq/s21_vector.h"
+#include "s21_sync_utils.h"
+#include "s21_work_stealing_deque.h"
+
+namespace s21 {
+
+// Fork-join thread pool with one Chase-Lev deque per worker. Tasks spawned
+// from a worker go to its own deque (LIFO, cache-warm); tasks spawned from
+// outside go through a shared injection queue. Idle workers steal from a
+// random victim before going to sleep. Waiting threads never block while
+// work is available: they execute pending tasks instead.
+class thread_pool {
+ public:
+  using size_type = std::size_t;
+
+  // Tracks completion of the tasks spawned through it. The first exception
+  // thrown by one of its tasks is rethrown from wait().
+  class task_group {
+   public:
+    explicit task_group(thread_pool& pool) : pool_(pool) {}
+    task_group(const task_group&) = delete;
+    task_group& operator=(const task_group&) = delete;
+    ~task_group() { pool_.help_until(pending_); }
+
+    template <class F>
+    void spawn(F&& f) {
+      pending_.fetch_add(1, std::memory_order_relaxed);
+      pool_.submit(new task{std::function<void()>(std::forward<F>(f)), this});
+    }
+
+    void wait();
+
+   private:
+    friend class thread_pool;
+
+    void finish(std::exception_ptr error) noexcept;
+
+    thread_pool& pool_;
+    std::atomic<size_type> pending_{0};
+    std::atomic<bool> failed_{false};
+    std::exception_ptr error_;
+  };
+
+  explicit thread_pool(
+      size_type threads = std::max(1u, std::thread::hardware_concurrency()));
+  thread_pool(const thread_pool&) = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+  ~thread_pool();
+
+  [[nodiscard]] size_type size() const noexcept { return workers_.size(); }
+
+  template <class F>
+  void spawn(F&& f) {
+    root_.spawn(std::forward<F>(f));
+  }
+  void wait() { root_.wait(); }
+
+  template <class F1, class F2>
+  void invoke(F1&& left, F2&& right);
+
+  template <class F>
+  void parallel_for(size_type first, size_type last, F&& body,
+                    size_type grain = 0);
+
+ private:
+  struct task {
+    std::function<void()> fn;
+    task_group* group;
+  };
+
+  struct worker {
+    explicit worker(size_type index) : rng(0x9e3779b97f4a7c15ull + index) {}
+    work_stealing_deque<task*> deque;
+    std::uint64_t rng;
+    std::thread thread;
+  };
+
+  struct worker_context {
+    thread_pool* pool = nullptr;
+    size_type index = 0;
+  };
+
+  static worker_context& current() noexcept {
+    static thread_local worker_context ctx;
+    return ctx;
+  }
+
+  worker* local_worker() noexcept {
+    worker_context& ctx = current();
+    return ctx.pool == this ? workers_[ctx.index].get() : nullptr;
+  }
+
+  void submit(task* t);
+  task* take(worker* self);
+  task* steal_from_others(worker* self);
+  void run(task* t) noexcept;
+  bool run_one();
+  void help_until(const std::atomic<size_type>& pending);
+  void worker_loop(size_type index);
+
+  vector<std::unique_ptr<worker>> workers_;
+  ring_buffer<task*> injected_;
+  std::mutex inject_mutex_;
+
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  std::atomic<size_type> queued_{0};
+  std::atomic<size_type> sleepers_{0};
+  bool stopping_ = false;
+
+  task_group root_{*this};
+};
+
+inline void thread_pool::task_group::wait() {
+  pool_.help_until(pending_);
+  if (failed_.load(std::memory_order_acquire)) {
+    std::exception_ptr error = std::move(error_);
+    error_ = nullptr;
+    failed_.store(false, std::memory_order_relaxed);
+    std::rethrow_exception(error);
+  }
+}
+
+inline void thread_pool::task_group::finish(std::exception_ptr error) noexcept {
+  if (error) {
+    bool expected = false;
+    if (failed_.compare_exchange_strong(expected, true,
+                                        std::memory_order_acq_rel))
+      error_ = std::move(error);
+  }
+  pending_.fetch_sub(1, std::memory_order_release);
+}
+
+inline thread_pool::thread_pool(size_type threads) {
+  if (threads == 0) threads = 1;
+  workers_.reserve(threads);
+  for (size_type i = 0; i < threads; ++i)
+    workers_.push_back(std::make_unique<worker>(i));
+  for (size_type i = 0; i < threads; ++i)
+    workers_[i]->thread = std::thread([this, i] { worker_loop(i); });
+}
+
+inline thread_pool::~thread_pool() {
+  help_until(root_.pending_);
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+  for (auto& w : workers_) w->thread.join();
+}
+
+inline void thread_pool::submit(task* t) {
+  if (worker* self = local_worker()) {
+    self->deque.push(t);
+  } else {
+    std::lock_guard<std::mutex> lock(inject_mutex_);
+    injected_.push_back(t);
+  }
+  queued_.fetch_add(1, std::memory_order_seq_cst);
+  if (sleepers_.load(std::memory_order_seq_cst) != 0) {
+    { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+    wake_.notify_one();
+  }
+}
+
+inline thread_pool::task* thread_pool::steal_from_others(worker* self) {
+  const size_type n = workers_.size();
+  size_type start = 0;
+  if (self) {
+    self->rng ^= self->rng << 13;
+    self->rng ^= self->rng >> 7;
+    self->rng ^= self->rng << 17;
+    start = static_cast<size_type>(self->rng % n);
+  }
+  task* t = nullptr;
+  for (size_type k = 0; k < n; ++k) {
+    worker* victim = workers_[(start + k) % n].get();
+    if (victim != self && victim->deque.steal(t)) return t;
+  }
+  return nullptr;
+}
+
+inline thread_pool::task* thread_pool::take(worker* self) {
+  task* t = nullptr;
+  if (self && self->deque.pop(t)) return t;
+  {
+    std::lock_guard<std::mutex> lock(inject_mutex_);
+    if (!injected_.empty()) {
+      t = injected_.front();
+      injected_.pop_front();
+      return t;
+    }
+  }
+  return steal_from_others(self);
+}
+
+inline void thread_pool::run(task* t) noexcept {
+  queued_.fetch_sub(1, std::memory_order_relaxed);
+  std::exception_ptr error;
+  try {
+    t->fn();
+  } catch (...) {
+    error = std::current_exception();
+  }
+  task_group* group = t->group;
+  delete t;
+  group->finish(std::move(error));
+}
+
+inline bool thread_pool::run_one() {
+  task* t = take(local_worker());
+  if (!t) return false;
+  run(t);
+  return true;
+}
+
+inline void thread_pool::help_until(const std::atomic<size_type>& pending) {
+  backoff idle;
+  while (pending.load(std::memory_order_acquire) != 0) {
+    if (run_one())
+      idle.reset();
+    else
+      idle.pause();
+  }
+}
+
+inline void thread_pool::worker_loop(size_type index) {
+  current() = worker_context{this, index};
+  worker* self = workers_[index].get();
+  backoff idle;
+  for (;;) {
+    if (task* t = take(self)) {
+      run(t);
+      idle.reset();
+      continue;
+    }
+    idle.pause();
+    if (queued_.load(std::memory_order_seq_cst) != 0) continue;
+
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    sleepers_.fetch_add(1, std::memory_order_seq_cst);
+    wake_.wait(lock, [this] {
+      return stopping_ || queued_.load(std::memory_order_seq_cst) != 0;
+    });
+    sleepers_.fetch_sub(1, std::memory_order_relaxed);
+    if (stopping_ && queued_.load(std::memory_order_seq_cst) == 0) return;
+    idle.reset();
+  }
+}
+
+// Runs right on a pool thread (or the caller) while left runs inline, then
+// helps execute pending work until both are done.
+template <class F1, class F2>
+void thread_pool::invoke(F1&& left, F2&& right) {
+  task_group group(*this);
+  group.spawn(std::forward<F2>(right));
+  std::forward<F1>(left)();
+  group.wait();
+}
+
+template <class F>
+void thread_pool::parallel_for(size_type first, size_type last, F&& body,
+                               size_type grain) {
+  if (first >= last) return;
+  const size_type n = last - first;
+  if (grain == 0) grain = std::max<size_type>(1, n / (workers_.size() * 8));
+  task_group group(*this);
+  for (size_type lo = first; lo < last; lo += grain) {
+    const size_type hi = std::min(last, lo + grain);
+    group.spawn([&body, lo, hi] {
+      for (size_type i = lo; i < hi; ++i) body(i);
+    });
+  }
+  group.wait();
+}
+
+}  // namespace s21
@@ -0,0 +1,150 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "../seq/s21_vector.h"
+#include "s21_sync_utils.h"
+
+namespace s21 {
+
+// Chase-Lev work-stealing deque (Le, Pop, Cohen, Zappa Nardelli, PPoPP'13).
+// The owning thread pushes and pops at the bottom; any other thread may
+// steal from the top. The circular array grows on demand; retired arrays
+// are kept until destruction because a thief may still be reading them.
+// Elements are copied through atomics, so T must be trivially copyable
+// (typically a pointer to a task).
+template <class T>
+class work_stealing_deque {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "s21::work_stealing_deque: T must be trivially copyable");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  explicit work_stealing_deque(size_type capacity = 64);
+  work_stealing_deque(const work_stealing_deque&) = delete;
+  work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+  ~work_stealing_deque() noexcept;
+
+  void push(value_type value);
+  bool pop(value_type& out);
+  bool steal(value_type& out);
+
+  [[nodiscard]] size_type size_approx() const noexcept;
+  [[nodiscard]] bool empty() const noexcept { return size_approx() == 0; }
+  [[nodiscard]] size_type capacity() const noexcept {
+    return ring_.load(std::memory_order_relaxed)->capacity;
+  }
+
+ private:
+  struct Ring {
+    explicit Ring(size_type cap)
+        : capacity(cap), slots(std::make_unique<std::atomic<T>[]>(cap)) {}
+
+    T load(std::int64_t i) const noexcept {
+      return slots[static_cast<size_type>(i) & (capacity - 1)].load(
+          std::memory_order_relaxed);
+    }
+    void store(std::int64_t i, T value) noexcept {
+      slots[static_cast<size_type>(i) & (capacity - 1)].store(
+          value, std::memory_order_relaxed);
+    }
+
+    size_type capacity;
+    std::unique_ptr<std::atomic<T>[]> slots;
+  };
+
+  Ring* grow(Ring* old, std::int64_t top, std::int64_t bottom);
+
+  alignas(kCacheLineSize) std::atomic<std::int64_t> top_{0};
+  alignas(kCacheLineSize) std::atomic<std::int64_t> bottom_{0};
+  std::atomic<Ring*> ring_;
+  vector<Ring*> retired_;
+};
+
+template <class T>
+work_stealing_deque<T>::work_stealing_deque(size_type capacity) {
+  size_type cap = 2;
+  while (cap < capacity) cap <<= 1;
+  ring_.store(new Ring(cap), std::memory_order_relaxed);
+}
+
+template <class T>
+work_stealing_deque<T>::~work_stealing_deque() noexcept {
+  delete ring_.load(std::memory_order_relaxed);
+  for (Ring* r : retired_) delete r;
+}
+
+template <class T>
+typename work_stealing_deque<T>::Ring* work_stealing_deque<T>::grow(
+    Ring* old, std::int64_t top, std::int64_t bottom) {
+  Ring* bigger = new Ring(old->capacity * 2);
+  for (std::int64_t i = top; i < bottom; ++i) bigger->store(i, old->load(i));
+  retired_.push_back(old);
+  ring_.store(bigger, std::memory_order_release);
+  return bigger;
+}
+
+template <class T>
+void work_stealing_deque<T>::push(value_type value) {
+  const std::int64_t b = bottom_.load(std::memory_order_relaxed);
+  const std::int64_t t = top_.load(std::memory_order_acquire);
+  Ring* r = ring_.load(std::memory_order_relaxed);
+  if (b - t > static_cast<std::int64_t>(r->capacity) - 1) r = grow(r, t, b);
+  r->store(b, value);
+  std::atomic_thread_fence(std::memory_order_release);
+  bottom_.store(b + 1, std::memory_order_relaxed);
+}
+
+template <class T>
+bool work_stealing_deque<T>::pop(value_type& out) {
+  const std::int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+  Ring* r = ring_.load(std::memory_order_relaxed);
+  bottom_.store(b, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  std::int64_t t = top_.load(std::memory_order_relaxed);
+
+  if (t > b) {
+    bottom_.store(b + 1, std::memory_order_relaxed);
+    return false;
+  }
+  out = r->load(b);
+  if (t == b) {
+    // Last element: race against thieves for it.
+    const bool won = top_.compare_exchange_strong(
+        t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    bottom_.store(b + 1, std::memory_order_relaxed);
+    return won;
+  }
+  return true;
+}
+
+template <class T>
+bool work_stealing_deque<T>::steal(value_type& out) {
+  std::int64_t t = top_.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const std::int64_t b = bottom_.load(std::memory_order_acquire);
+  if (t >= b) return false;
+
+  Ring* r = ring_.load(std::memory_order_acquire);
+  const T value = r->load(t);
+  if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed))
+    return false;
+  out = value;
+  return true;
+}
+
+template <class T>
+typename work_stealing_deque<T>::size_type
+work_stealing_deque<T>::size_approx() const noexcept {
+  const std::int64_t b = bottom_.load(std::memory_order_relaxed);
+  const std::int64_t t = top_.load(std::memory_order_relaxed);
+  return b > t ? static_cast<size_type>(b - t) : 0;
+}
+
+}  // namespace s21
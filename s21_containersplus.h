@@ -1,3 +1,23 @@
 #pragma once
+#include "assoc/s21_btree_map.h"
+#include "assoc/s21_btree_multiset.h"
+#include "assoc/s21_btree_set.h"
 #include "assoc/s21_multiset.h"
-#include "seq/s21_array.h"
\ No newline at end of file
+#include "assoc/s21_unordered_map.h"
+#include "assoc/s21_unordered_multimap.h"
+#include "assoc/s21_unordered_multiset.h"
+#include "assoc/s21_unordered_set.h"
+#include "conc/s21_blocking_queue.h"
+#include "conc/s21_concurrent_map.h"
+#include "conc/s21_lockfree_stack.h"
+#include "conc/s21_mpmc_queue.h"
+#include "conc/s21_spsc_queue.h"
+#include "conc/s21_thread_pool.h"
+#include "conc/s21_work_stealing_deque.h"
+#include "seq/s21_array.h"
+#include "seq/s21_indexed_heap.h"
+#include "seq/s21_mdview.h"
+#include "seq/s21_minmax_heap.h"
+#include "seq/s21_priority_queue.h"
+#include "seq/s21_ring_buffer.h"
+#include "seq/s21_static_vector.h"
@@ -1,15 +1,18 @@
 #pragma once
 
-#include <algorithm>
-#include <initializer_list>
+#include <cstddef>
 #include <stdexcept>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
 namespace s21 {
 
+// Fixed-size aggregate: brace initialization, copies and moves are the
+// implicit ones, so an array of literal types is a literal type and
+// constexpr tables built from it are emitted as constant data.
 template <typename T, std::size_t N>
-class array {
- public:
+struct array {
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
@@ -17,76 +20,162 @@ class array {
   using const_iterator = const T*;
   using size_type = std::size_t;
 
-  array() = default;
-
-  array(std::initializer_list<value_type> const& items) {
-    size_type count = std::min(items.size(), N);
-    std::copy(items.begin(), items.begin() + count, data_);
-  }
-
-  array(const array& other) = default;
-
-  array(array&& other) noexcept {
-    std::move(std::begin(other.data_), std::end(other.data_), data_);
-  }
-
-  ~array() = default;
-
-  array& operator=(const array& other) = default;
-
-  array& operator=(array&& other) noexcept {
-    if (this != &other) {
-      std::move(std::begin(other.data_), std::end(other.data_), data_);
-    }
-    return *this;
-  }
-
-  reference at(size_type pos) {
+  constexpr reference at(size_type pos) {
     if (pos >= N) throw std::out_of_range("array index is out of bounds");
     return data_[pos];
   }
-  const_reference at(size_type pos) const {
+  constexpr const_reference at(size_type pos) const {
     if (pos >= N) throw std::out_of_range("array index is out of bounds");
     return data_[pos];
   }
 
-  reference operator[](size_type pos) { return data_[pos]; }
-  const_reference operator[](size_type pos) const { return data_[pos]; }
+  constexpr reference operator[](size_type pos) { return data_[pos]; }
+  constexpr const_reference operator[](size_type pos) const {
+    return data_[pos];
+  }
 
-  reference front() { return data_[0]; }
-  const_reference front() const { return data_[0]; }
+  constexpr reference front() { return data_[0]; }
+  constexpr const_reference front() const { return data_[0]; }
 
-  reference back() { return data_[N - 1]; }
-  const_reference back() const { return data_[N - 1]; }
+  constexpr reference back() { return data_[N - 1]; }
+  constexpr const_reference back() const { return data_[N - 1]; }
 
-  value_type* data() noexcept { return data_; }
-  const value_type* data() const noexcept { return data_; }
+  constexpr value_type* data() noexcept { return data_; }
+  constexpr const value_type* data() const noexcept { return data_; }
 
-  iterator begin() noexcept { return data_; }
-  const_iterator begin() const noexcept { return data_; }
-  const_iterator cbegin() const noexcept { return data_; }
+  constexpr iterator begin() noexcept { return data_; }
+  constexpr const_iterator begin() const noexcept { return data_; }
+  constexpr const_iterator cbegin() const noexcept { return data_; }
 
-  iterator end() noexcept { return data_ + N; }
-  const_iterator end() const noexcept { return data_ + N; }
-  const_iterator cend() const noexcept { return end(); }
+  constexpr iterator end() noexcept { return data_ + N; }
+  constexpr const_iterator end() const noexcept { return data_ + N; }
+  constexpr const_iterator cend() const noexcept { return end(); }
 
-  bool empty() const noexcept { return N == 0; }
-  size_type size() const noexcept { return N; }
-  size_type max_size() const noexcept { return N; }
+  [[nodiscard]] constexpr bool empty() const noexcept { return N == 0; }
+  constexpr size_type size() const noexcept { return N; }
+  constexpr size_type max_size() const noexcept { return N; }
 
-  void swap(array& other) noexcept {
+  constexpr void swap(array& other) noexcept(
+      std::is_nothrow_swappable_v<T>) {
     for (size_type i = 0; i < N; ++i) {
       using std::swap;
       swap(data_[i], other.data_[i]);
     }
   }
 
-  void fill(const_reference value) {
+  constexpr void fill(const_reference value) {
     for (size_type i = 0; i < N; ++i) data_[i] = value;
   }
 
- private:
+  // Public only so that the class stays an aggregate; use data().
   value_type data_[N]{};
 };
 
-}  // namespace s21
\ No newline at end of file
+// A zero-length array holds no element, so T need not be default
+// constructible; data() is null and begin() == end().
+template <typename T>
+struct array<T, 0> {
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using size_type = std::size_t;
+
+  constexpr reference at(size_type) {
+    throw std::out_of_range("array index is out of bounds");
+  }
+  constexpr const_reference at(size_type) const {
+    throw std::out_of_range("array index is out of bounds");
+  }
+
+  // Like front() and back(), undefined for an empty array.
+  constexpr reference operator[](size_type) { return *data(); }
+  constexpr const_reference operator[](size_type) const { return *data(); }
+
+  constexpr reference front() { return *data(); }
+  constexpr const_reference front() const { return *data(); }
+
+  constexpr reference back() { return *data(); }
+  constexpr const_reference back() const { return *data(); }
+
+  constexpr value_type* data() noexcept { return nullptr; }
+  constexpr const value_type* data() const noexcept { return nullptr; }
+
+  constexpr iterator begin() noexcept { return data(); }
+  constexpr const_iterator begin() const noexcept { return data(); }
+  constexpr const_iterator cbegin() const noexcept { return data(); }
+
+  constexpr iterator end() noexcept { return data(); }
+  constexpr const_iterator end() const noexcept { return data(); }
+  constexpr const_iterator cend() const noexcept { return data(); }
+
+  [[nodiscard]] constexpr bool empty() const noexcept { return true; }
+  constexpr size_type size() const noexcept { return 0; }
+  constexpr size_type max_size() const noexcept { return 0; }
+
+  constexpr void swap(array&) noexcept {}
+  constexpr void fill(const_reference) {}
+};
+
+template <typename T, std::size_t N>
+constexpr void swap(array<T, N>& lhs,
+                    array<T, N>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+  lhs.swap(rhs);
+}
+
+template <std::size_t I, typename T, std::size_t N>
+constexpr T& get(array<T, N>& a) noexcept {
+  static_assert(I < N, "s21::get: index out of bounds");
+  return a.data_[I];
+}
+
+template <std::size_t I, typename T, std::size_t N>
+constexpr const T& get(const array<T, N>& a) noexcept {
+  static_assert(I < N, "s21::get: index out of bounds");
+  return a.data_[I];
+}
+
+template <std::size_t I, typename T, std::size_t N>
+constexpr T&& get(array<T, N>&& a) noexcept {
+  static_assert(I < N, "s21::get: index out of bounds");
+  return std::move(a.data_[I]);
+}
+
+namespace detail {
+
+template <typename T, std::size_t N, std::size_t... I>
+constexpr array<std::remove_cv_t<T>, N> to_array_copy(
+    T (&a)[N], std::index_sequence<I...>) {
+  return {{a[I]...}};
+}
+
+template <typename T, std::size_t N, std::size_t... I>
+constexpr array<std::remove_cv_t<T>, N> to_array_move(
+    T (&&a)[N], std::index_sequence<I...>) {
+  return {{std::move(a[I])...}};
+}
+
+}  // namespace detail
+
+template <typename T, std::size_t N>
+constexpr array<std::remove_cv_t<T>, N> to_array(T (&a)[N]) {
+  return detail::to_array_copy(a, std::make_index_sequence<N>{});
+}
+
+template <typename T, std::size_t N>
+constexpr array<std::remove_cv_t<T>, N> to_array(T (&&a)[N]) {
+  return detail::to_array_move(std::move(a), std::make_index_sequence<N>{});
+}
+
+}  // namespace s21
+
+template <typename T, std::size_t N>
+struct std::tuple_size<s21::array<T, N>>
+    : std::integral_constant<std::size_t, N> {};
+
+template <std::size_t I, typename T, std::size_t N>
+struct std::tuple_element<I, s21::array<T, N>> {
+  static_assert(I < N, "s21::array: tuple_element index out of bounds");
+  using type = T;
+};
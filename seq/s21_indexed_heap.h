@@ -0,0 +1,226 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../seq/s21_vector.h"
+
+namespace s21 {
+
+// Addressable d-ary heap. Compare has the priority_queue meaning: top() is
+// an element that no other compares greater than, so std::less gives a
+// max-heap. The default std::greater makes it a min-heap, the order
+// Dijkstra and timer queues want. push returns a stable handle; a
+// position map from handle to heap slot makes
+// update/decrease_key/increase_key/erase O(log n) without any search.
+// Handles of popped or erased entries are recycled by later pushes.
+template <class T, class Compare = std::greater<T>, std::size_t Arity = 4>
+class indexed_heap {
+  static_assert(Arity >= 2, "s21::indexed_heap: arity must be at least 2");
+
+ public:
+  using value_type = T;
+  using value_compare = Compare;
+  using size_type = std::size_t;
+  using handle = std::size_t;
+  using const_reference = const value_type&;
+
+  indexed_heap() = default;
+  explicit indexed_heap(const Compare& comp) : comp_(comp) {}
+
+  [[nodiscard]] bool empty() const noexcept { return heap_.empty(); }
+  [[nodiscard]] size_type size() const noexcept { return heap_.size(); }
+  void reserve(size_type n);
+  void clear();
+
+  const_reference top() const { return heap_[0].value; }
+  handle top_handle() const { return heap_[0].id; }
+
+  handle push(const_reference value) { return emplace(value); }
+  handle push(value_type&& value) { return emplace(std::move(value)); }
+  template <class... Args>
+  handle emplace(Args&&... args);
+  void pop();
+
+  [[nodiscard]] bool contains(handle h) const noexcept {
+    return h < pos_.size() && pos_[h] != kNpos;
+  }
+  const_reference value(handle h) const;
+
+  void update(handle h, value_type new_value);
+  void decrease_key(handle h, value_type new_value);
+  void increase_key(handle h, value_type new_value);
+  void erase(handle h);
+
+ private:
+  struct Entry {
+    value_type value;
+    handle id;
+  };
+
+  static constexpr size_type kNpos = std::numeric_limits<size_type>::max();
+
+  static size_type parent(size_type i) noexcept { return (i - 1) / Arity; }
+  static size_type first_child(size_type i) noexcept { return i * Arity + 1; }
+
+  // True when a belongs nearer the top than b.
+  bool above(const value_type& a, const value_type& b) const {
+    return comp_(b, a);
+  }
+  void check_handle(handle h) const;
+  void place(size_type i, Entry&& e) {
+    pos_[e.id] = i;
+    heap_[i] = std::move(e);
+  }
+  void sift_up(size_type i);
+  void sift_down(size_type i);
+  void remove_at(size_type i);
+
+  vector<Entry> heap_;
+  vector<size_type> pos_;
+  vector<handle> free_ids_;
+  [[no_unique_address]] Compare comp_;
+};
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::reserve(size_type n) {
+  heap_.reserve(n);
+  pos_.reserve(n);
+}
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::clear() {
+  heap_.clear();
+  pos_.clear();
+  free_ids_.clear();
+}
+
+template <class T, class Compare, std::size_t Arity>
+template <class... Args>
+typename indexed_heap<T, Compare, Arity>::handle
+indexed_heap<T, Compare, Arity>::emplace(Args&&... args) {
+  handle id;
+  if (!free_ids_.empty()) {
+    id = free_ids_.back();
+    free_ids_.pop_back();
+  } else {
+    id = pos_.size();
+    pos_.push_back(kNpos);
+  }
+  heap_.push_back(Entry{value_type(std::forward<Args>(args)...), id});
+  pos_[id] = heap_.size() - 1;
+  sift_up(heap_.size() - 1);
+  return id;
+}
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::pop() {
+  if (!heap_.empty()) remove_at(0);
+}
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::check_handle(handle h) const {
+  if (!contains(h))
+    throw std::out_of_range("s21::indexed_heap: invalid handle");
+}
+
+template <class T, class Compare, std::size_t Arity>
+typename indexed_heap<T, Compare, Arity>::const_reference
+indexed_heap<T, Compare, Arity>::value(handle h) const {
+  check_handle(h);
+  return heap_[pos_[h]].value;
+}
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::update(handle h, value_type new_value) {
+  check_handle(h);
+  const size_type i = pos_[h];
+  const bool moves_up = above(new_value, heap_[i].value);
+  heap_[i].value = std::move(new_value);
+  if (moves_up)
+    sift_up(i);
+  else
+    sift_down(i);
+}
+
+// Caller guarantees the new value belongs no lower than the old one (with
+// the default std::greater: is not larger), so it can only move up.
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::decrease_key(handle h,
+                                                   value_type new_value) {
+  check_handle(h);
+  const size_type i = pos_[h];
+  heap_[i].value = std::move(new_value);
+  sift_up(i);
+}
+
+// Caller guarantees the new value belongs no higher than the old one (with
+// the default std::greater: is not smaller), so it can only move down.
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::increase_key(handle h,
+                                                   value_type new_value) {
+  check_handle(h);
+  const size_type i = pos_[h];
+  heap_[i].value = std::move(new_value);
+  sift_down(i);
+}
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::erase(handle h) {
+  check_handle(h);
+  remove_at(pos_[h]);
+}
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::remove_at(size_type i) {
+  const handle id = heap_[i].id;
+  pos_[id] = kNpos;
+  free_ids_.push_back(id);
+
+  const size_type last = heap_.size() - 1;
+  if (i != last) {
+    place(i, std::move(heap_[last]));
+    heap_.pop_back();
+    if (i > 0 && above(heap_[i].value, heap_[parent(i)].value))
+      sift_up(i);
+    else
+      sift_down(i);
+  } else {
+    heap_.pop_back();
+  }
+}
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::sift_up(size_type i) {
+  Entry hole = std::move(heap_[i]);
+  while (i > 0) {
+    const size_type p = parent(i);
+    if (!above(hole.value, heap_[p].value)) break;
+    place(i, std::move(heap_[p]));
+    i = p;
+  }
+  place(i, std::move(hole));
+}
+
+template <class T, class Compare, std::size_t Arity>
+void indexed_heap<T, Compare, Arity>::sift_down(size_type i) {
+  const size_type n = heap_.size();
+  Entry hole = std::move(heap_[i]);
+  for (;;) {
+    const size_type first = first_child(i);
+    if (first >= n) break;
+    const size_type last = (n - first > Arity) ? first + Arity : n;
+    size_type best = first;
+    for (size_type c = first + 1; c < last; ++c) {
+      if (above(heap_[c].value, heap_[best].value)) best = c;
+    }
+    if (!above(heap_[best].value, hole.value)) break;
+    place(i, std::move(heap_[best]));
+    i = best;
+  }
+  place(i, std::move(hole));
+}
+
+}  // namespace s21
@@ -57,6 +57,9 @@ class list {
   iterator insert(iterator pos, const_reference value);
   void erase(iterator pos);
   void push_back(const_reference value);
+  void push_back(value_type&& value);
+  template <class... Args>
+  reference emplace_back(Args&&... args);
   void pop_back();
   void push_front(const_reference value);
   void pop_front();
@@ -249,6 +252,20 @@ void list<T>::push_back(const_reference value) {
   ++size_;
 }
 
+template <class T>
+void list<T>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <class T>
+template <class... Args>
+typename list<T>::reference list<T>::emplace_back(Args&&... args) {
+  Node* n = new Node{value_type(std::forward<Args>(args)...), nullptr, nullptr};
+  link_between_(sentinel_->prev, n, sentinel_);
+  ++size_;
+  return n->value;
+}
+
 template <class T>
 void list<T>::push_front(const_reference value) {
   Node* n = create_node_(value);
@@ -0,0 +1,336 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../seq/s21_array.h"
+
+namespace s21 {
+
+inline constexpr std::size_t dynamic_extent =
+    std::numeric_limits<std::size_t>::max();
+
+// Shape of a multidimensional index space. Each extent is either fixed at
+// compile time or dynamic_extent, in which case it is stored and passed to
+// the constructor in order. Static extents fold into the index arithmetic,
+// so inner loops over them see constant trip counts and strides.
+template <std::size_t... Exts>
+class extents {
+  static constexpr std::size_t kRank = sizeof...(Exts);
+  static constexpr std::size_t kRankDynamic =
+      ((Exts == dynamic_extent ? 1 : 0) + ... + 0);
+
+ public:
+  using size_type = std::size_t;
+
+  static constexpr size_type rank() noexcept { return kRank; }
+  static constexpr size_type rank_dynamic() noexcept { return kRankDynamic; }
+  static constexpr size_type static_extent(size_type r) noexcept {
+    return kStatic[r];
+  }
+
+  constexpr extents() noexcept = default;
+  template <class... Dyn>
+    requires(sizeof...(Dyn) == kRankDynamic &&
+             (std::is_convertible_v<Dyn, size_type> && ...))
+  constexpr explicit extents(Dyn... dyn) noexcept
+      : dynamic_{{static_cast<size_type>(dyn)...}} {}
+
+  constexpr size_type extent(size_type r) const noexcept {
+    return kStatic[r] != dynamic_extent ? kStatic[r]
+                                        : dynamic_[dynamic_index(r)];
+  }
+
+  constexpr size_type size() const noexcept {
+    size_type n = 1;
+    for (size_type r = 0; r < rank(); ++r) n *= extent(r);
+    return n;
+  }
+
+  friend constexpr bool operator==(const extents& a,
+                                   const extents& b) noexcept {
+    for (size_type r = 0; r < rank(); ++r)
+      if (a.extent(r) != b.extent(r)) return false;
+    return true;
+  }
+
+ private:
+  static constexpr array<size_type, kRank> kStatic{{Exts...}};
+
+  static constexpr size_type dynamic_index(size_type r) noexcept {
+    size_type k = 0;
+    for (size_type i = 0; i < r; ++i)
+      if (kStatic[i] == dynamic_extent) ++k;
+    return k;
+  }
+
+  // Fully static extents take no storage at all.
+  struct NoDynamic {
+    constexpr size_type operator[](size_type) const noexcept { return 0; }
+  };
+  using Dynamic = std::conditional_t<kRankDynamic == 0, NoDynamic,
+                                     array<size_type, kRankDynamic>>;
+
+  [[no_unique_address]] Dynamic dynamic_{};
+};
+
+namespace detail {
+
+template <std::size_t Rank, std::size_t... I>
+auto make_dextents(std::index_sequence<I...>)
+    -> extents<((void)I, dynamic_extent)...>;
+
+}  // namespace detail
+
+template <std::size_t Rank>
+using dextents =
+    decltype(detail::make_dextents<Rank>(std::make_index_sequence<Rank>{}));
+
+// Row-major: the last index is contiguous.
+struct layout_right {
+  template <class Extents>
+  class mapping {
+   public:
+    using extents_type = Extents;
+    using size_type = typename Extents::size_type;
+
+    constexpr mapping() noexcept = default;
+    constexpr explicit mapping(const Extents& ext) noexcept : ext_(ext) {}
+
+    constexpr const Extents& extents() const noexcept { return ext_; }
+    constexpr size_type required_span_size() const noexcept {
+      return ext_.size();
+    }
+    constexpr size_type stride(size_type r) const noexcept {
+      size_type s = 1;
+      for (size_type k = r + 1; k < Extents::rank(); ++k) s *= ext_.extent(k);
+      return s;
+    }
+
+    template <class... I>
+    constexpr size_type operator()(I... idx) const noexcept {
+      size_type offset = 0;
+      size_type r = 0;
+      ((offset = offset * ext_.extent(r++) + static_cast<size_type>(idx)),
+       ...);
+      return offset;
+    }
+
+   private:
+    Extents ext_;
+  };
+};
+
+// Column-major: the first index is contiguous.
+struct layout_left {
+  template <class Extents>
+  class mapping {
+   public:
+    using extents_type = Extents;
+    using size_type = typename Extents::size_type;
+
+    constexpr mapping() noexcept = default;
+    constexpr explicit mapping(const Extents& ext) noexcept : ext_(ext) {}
+
+    constexpr const Extents& extents() const noexcept { return ext_; }
+    constexpr size_type required_span_size() const noexcept {
+      return ext_.size();
+    }
+    constexpr size_type stride(size_type r) const noexcept {
+      size_type s = 1;
+      for (size_type k = 0; k < r; ++k) s *= ext_.extent(k);
+      return s;
+    }
+
+    template <class... I>
+    constexpr size_type operator()(I... idx) const noexcept {
+      const size_type ix[] = {static_cast<size_type>(idx)...};
+      size_type offset = 0;
+      for (size_type r = Extents::rank(); r-- > 0;)
+        offset = offset * ext_.extent(r) + ix[r];
+      return offset;
+    }
+
+   private:
+    Extents ext_;
+  };
+};
+
+// Arbitrary per-dimension strides, e.g. a submatrix, every other column or
+// a transposed view of row-major data.
+struct layout_stride {
+  template <class Extents>
+  class mapping {
+   public:
+    using extents_type = Extents;
+    using size_type = typename Extents::size_type;
+    using strides_type = array<size_type, Extents::rank()>;
+
+    constexpr mapping() noexcept = default;
+    constexpr mapping(const Extents& ext, const strides_type& strides) noexcept
+        : ext_(ext), strides_(strides) {}
+
+    constexpr const Extents& extents() const noexcept { return ext_; }
+    constexpr size_type required_span_size() const noexcept {
+      size_type span = 1;
+      for (size_type r = 0; r < Extents::rank(); ++r) {
+        if (ext_.extent(r) == 0) return 0;
+        span += (ext_.extent(r) - 1) * strides_[r];
+      }
+      return span;
+    }
+    constexpr size_type stride(size_type r) const noexcept {
+      return strides_[r];
+    }
+
+    template <class... I>
+    constexpr size_type operator()(I... idx) const noexcept {
+      size_type offset = 0;
+      size_type r = 0;
+      ((offset += static_cast<size_type>(idx) * strides_[r++]), ...);
+      return offset;
+    }
+
+   private:
+    Extents ext_;
+    strides_type strides_{};
+  };
+};
+
+// Two-dimensional blocked layout: TileRows x TileCols tiles are stored
+// row-major, and so are the elements inside each tile. Edge tiles are
+// padded, so the span may exceed rows * cols. A tile that fits in L1 keeps
+// both row and column walks inside a few cache lines.
+template <std::size_t TileRows, std::size_t TileCols = TileRows>
+struct layout_tiled {
+  static_assert(TileRows > 0 && TileCols > 0,
+                "s21::layout_tiled: tile extents must be positive");
+
+  template <class Extents>
+  class mapping {
+    static_assert(Extents::rank() == 2, "s21::layout_tiled: rank must be 2");
+
+   public:
+    using extents_type = Extents;
+    using size_type = typename Extents::size_type;
+
+    static constexpr size_type tile_rows = TileRows;
+    static constexpr size_type tile_cols = TileCols;
+
+    constexpr mapping() noexcept = default;
+    constexpr explicit mapping(const Extents& ext) noexcept
+        : ext_(ext),
+          tiles_per_row_((ext.extent(1) + TileCols - 1) / TileCols) {}
+
+    constexpr const Extents& extents() const noexcept { return ext_; }
+    constexpr size_type required_span_size() const noexcept {
+      const size_type tile_count =
+          (ext_.extent(0) + TileRows - 1) / TileRows * tiles_per_row_;
+      return tile_count * TileRows * TileCols;
+    }
+
+    constexpr size_type operator()(size_type i, size_type j) const noexcept {
+      const size_type tile = (i / TileRows) * tiles_per_row_ + j / TileCols;
+      return tile * (TileRows * TileCols) + (i % TileRows) * TileCols +
+             j % TileCols;
+    }
+
+   private:
+    Extents ext_;
+    size_type tiles_per_row_ = 0;
+  };
+};
+
+// Non-owning multidimensional view over contiguous storage (mdspan-style).
+// Indexing goes through the layout mapping; the view never allocates and
+// copies in O(1).
+template <class T, class Extents, class Layout = layout_right>
+class mdview {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using extents_type = Extents;
+  using layout_type = Layout;
+  using mapping_type = typename Layout::template mapping<Extents>;
+  using size_type = typename Extents::size_type;
+  using pointer = T*;
+  using reference = T&;
+
+  constexpr mdview() noexcept = default;
+  template <class... Dyn>
+    requires(sizeof...(Dyn) == Extents::rank_dynamic())
+  constexpr explicit mdview(pointer data, Dyn... dyn) noexcept
+      : data_(data), map_(Extents(dyn...)) {}
+  constexpr mdview(pointer data, const mapping_type& map) noexcept
+      : data_(data), map_(map) {}
+
+  // View over any container with data() and size(), e.g. s21::vector or
+  // s21::array; throws if the container is shorter than the mapped span.
+  template <class Container, class... Dyn>
+    requires(sizeof...(Dyn) == Extents::rank_dynamic() &&
+             requires(Container& c) {
+               { c.data() } -> std::convertible_to<pointer>;
+               c.size();
+             })
+  constexpr explicit mdview(Container& c, Dyn... dyn)
+      : mdview(c.data(), dyn...) {
+    check_span(c.size());
+  }
+  template <class Container>
+    requires requires(Container& c) {
+      { c.data() } -> std::convertible_to<pointer>;
+      c.size();
+    }
+  constexpr mdview(Container& c, const mapping_type& map)
+      : mdview(c.data(), map) {
+    check_span(c.size());
+  }
+
+  static constexpr size_type rank() noexcept { return Extents::rank(); }
+  constexpr size_type extent(size_type r) const noexcept {
+    return map_.extents().extent(r);
+  }
+  constexpr size_type size() const noexcept {
+    return map_.extents().size();
+  }
+  [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+  constexpr size_type stride(size_type r) const noexcept {
+    return map_.stride(r);
+  }
+
+  constexpr pointer data() const noexcept { return data_; }
+  constexpr const mapping_type& mapping() const noexcept { return map_; }
+  constexpr const extents_type& extents() const noexcept {
+    return map_.extents();
+  }
+
+  template <class... I>
+    requires(sizeof...(I) == Extents::rank())
+  constexpr reference operator()(I... idx) const noexcept {
+    return data_[map_(static_cast<size_type>(idx)...)];
+  }
+
+  template <class... I>
+    requires(sizeof...(I) == Extents::rank())
+  constexpr reference at(I... idx) const {
+    size_type r = 0;
+    const bool inside = ((static_cast<size_type>(idx) < extent(r++)) && ...);
+    if (!inside) throw std::out_of_range("s21::mdview::at: index out of range");
+    return (*this)(idx...);
+  }
+
+ private:
+  constexpr void check_span(size_type available) const {
+    if (map_.required_span_size() > available)
+      throw std::length_error(
+          "s21::mdview: container is smaller than the mapped span");
+  }
+
+  pointer data_ = nullptr;
+  mapping_type map_;
+};
+
+}  // namespace s21
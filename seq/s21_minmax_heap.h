@@ -0,0 +1,216 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "../seq/s21_vector.h"
+
+namespace s21 {
+
+// Min-max heap (Atkinson et al.) on contiguous storage: nodes on even
+// levels are no greater than their descendants and nodes on odd levels are
+// no less, so the minimum is the root and the maximum is one of its
+// children. Both ends are O(1) to read and O(log n) to pop.
+template <class T, class Compare = std::less<T>>
+class minmax_heap {
+ public:
+  using value_type = T;
+  using value_compare = Compare;
+  using size_type = std::size_t;
+  using const_reference = const value_type&;
+
+  minmax_heap() = default;
+  explicit minmax_heap(const Compare& comp) : comp_(comp) {}
+  minmax_heap(std::initializer_list<value_type> items,
+              const Compare& comp = Compare())
+      : minmax_heap(items.begin(), items.end(), comp) {}
+  template <class InputIt>
+  minmax_heap(InputIt first, InputIt last, const Compare& comp = Compare());
+
+  [[nodiscard]] bool empty() const noexcept { return base_.empty(); }
+  [[nodiscard]] size_type size() const noexcept { return base_.size(); }
+  void reserve(size_type n) { base_.reserve(n); }
+  void clear() { base_.clear(); }
+
+  const_reference min() const { return base_[0]; }
+  const_reference max() const { return base_[max_index()]; }
+
+  void push(const_reference value);
+  void push(value_type&& value);
+  template <class... Args>
+  void emplace(Args&&... args);
+  void pop_min();
+  void pop_max();
+
+  void swap(minmax_heap& other) noexcept;
+
+ private:
+  static bool on_min_level(size_type i) noexcept {
+    return (std::bit_width(i + 1) & 1u) == 1u;
+  }
+  static size_type parent(size_type i) noexcept { return (i - 1) / 2; }
+
+  // "Before" in heap order: less for min levels, greater for max levels.
+  template <bool MinLevel>
+  bool before(const_reference a, const_reference b) const {
+    if constexpr (MinLevel)
+      return comp_(a, b);
+    else
+      return comp_(b, a);
+  }
+
+  size_type max_index() const noexcept;
+  void bubble_up(size_type i);
+  template <bool MinLevel>
+  void bubble_up_grandparents(size_type i);
+  void trickle_down(size_type i);
+  template <bool MinLevel>
+  void trickle_down_impl(size_type i);
+  void remove_at(size_type i);
+
+  vector<value_type> base_;
+  [[no_unique_address]] Compare comp_;
+};
+
+template <class T, class Compare>
+template <class InputIt>
+minmax_heap<T, Compare>::minmax_heap(InputIt first, InputIt last,
+                                     const Compare& comp)
+    : comp_(comp) {
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                  typename std::iterator_traits<
+                                      InputIt>::iterator_category>) {
+    base_.reserve(static_cast<size_type>(std::distance(first, last)));
+  }
+  for (; first != last; ++first) base_.push_back(*first);
+  for (size_type i = base_.size() / 2; i-- > 0;) trickle_down(i);
+}
+
+template <class T, class Compare>
+typename minmax_heap<T, Compare>::size_type
+minmax_heap<T, Compare>::max_index() const noexcept {
+  const size_type n = base_.size();
+  if (n <= 1) return 0;
+  if (n == 2) return 1;
+  return comp_(base_[1], base_[2]) ? 2 : 1;
+}
+
+template <class T, class Compare>
+void minmax_heap<T, Compare>::push(const_reference value) {
+  base_.push_back(value);
+  bubble_up(base_.size() - 1);
+}
+
+template <class T, class Compare>
+void minmax_heap<T, Compare>::push(value_type&& value) {
+  base_.push_back(std::move(value));
+  bubble_up(base_.size() - 1);
+}
+
+template <class T, class Compare>
+template <class... Args>
+void minmax_heap<T, Compare>::emplace(Args&&... args) {
+  base_.emplace_back(std::forward<Args>(args)...);
+  bubble_up(base_.size() - 1);
+}
+
+template <class T, class Compare>
+void minmax_heap<T, Compare>::pop_min() {
+  if (!base_.empty()) remove_at(0);
+}
+
+template <class T, class Compare>
+void minmax_heap<T, Compare>::pop_max() {
+  if (!base_.empty()) remove_at(max_index());
+}
+
+template <class T, class Compare>
+void minmax_heap<T, Compare>::swap(minmax_heap& other) noexcept {
+  using std::swap;
+  base_.swap(other.base_);
+  swap(comp_, other.comp_);
+}
+
+template <class T, class Compare>
+void minmax_heap<T, Compare>::remove_at(size_type i) {
+  const size_type last = base_.size() - 1;
+  if (i != last) base_[i] = std::move(base_[last]);
+  base_.pop_back();
+  if (i < base_.size()) trickle_down(i);
+}
+
+template <class T, class Compare>
+void minmax_heap<T, Compare>::bubble_up(size_type i) {
+  if (i == 0) return;
+  const size_type p = parent(i);
+  using std::swap;
+  if (on_min_level(i)) {
+    if (before<false>(base_[i], base_[p])) {
+      swap(base_[i], base_[p]);
+      bubble_up_grandparents<false>(p);
+    } else {
+      bubble_up_grandparents<true>(i);
+    }
+  } else {
+    if (before<true>(base_[i], base_[p])) {
+      swap(base_[i], base_[p]);
+      bubble_up_grandparents<true>(p);
+    } else {
+      bubble_up_grandparents<false>(i);
+    }
+  }
+}
+
+template <class T, class Compare>
+template <bool MinLevel>
+void minmax_heap<T, Compare>::bubble_up_grandparents(size_type i) {
+  using std::swap;
+  while (i > 2) {
+    const size_type g = parent(parent(i));
+    if (!before<MinLevel>(base_[i], base_[g])) break;
+    swap(base_[i], base_[g]);
+    i = g;
+  }
+}
+
+template <class T, class Compare>
+void minmax_heap<T, Compare>::trickle_down(size_type i) {
+  if (on_min_level(i))
+    trickle_down_impl<true>(i);
+  else
+    trickle_down_impl<false>(i);
+}
+
+template <class T, class Compare>
+template <bool MinLevel>
+void minmax_heap<T, Compare>::trickle_down_impl(size_type i) {
+  using std::swap;
+  const size_type n = base_.size();
+  for (;;) {
+    const size_type child = 2 * i + 1;
+    if (child >= n) return;
+
+    // Best among up to two children and four grandchildren.
+    size_type m = child;
+    if (child + 1 < n && before<MinLevel>(base_[child + 1], base_[m]))
+      m = child + 1;
+    const size_type grand = 2 * child + 1;
+    for (size_type g = grand; g < grand + 4 && g < n; ++g) {
+      if (before<MinLevel>(base_[g], base_[m])) m = g;
+    }
+
+    if (!before<MinLevel>(base_[m], base_[i])) return;
+    swap(base_[m], base_[i]);
+    if (m < grand) return;
+
+    const size_type p = parent(m);
+    if (before<MinLevel>(base_[p], base_[m])) swap(base_[m], base_[p]);
+    i = m;
+  }
+}
+
+}  // namespace s21
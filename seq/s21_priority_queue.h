@@ -0,0 +1,192 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "../seq/s21_vector.h"
+
+namespace s21 {
+
+// Implicit d-ary max-heap (with respect to Compare) over a contiguous
+// sequence. Arity 4 halves the tree height and keeps all children of a node
+// in one or two cache lines, which usually beats the binary layout on pop.
+template <class T, class Compare = std::less<T>, class Container = vector<T>,
+          std::size_t Arity = 2>
+class priority_queue {
+  static_assert(Arity >= 2, "s21::priority_queue: arity must be at least 2");
+
+ public:
+  using container_type = Container;
+  using value_compare = Compare;
+  using value_type = T;
+  using size_type = typename Container::size_type;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+
+  static constexpr size_type arity = Arity;
+
+  priority_queue() = default;
+  explicit priority_queue(const Compare& comp) : comp_(comp) {}
+  priority_queue(std::initializer_list<value_type> items,
+                 const Compare& comp = Compare());
+  template <class InputIt>
+  priority_queue(InputIt first, InputIt last, const Compare& comp = Compare());
+  explicit priority_queue(Container&& base, const Compare& comp = Compare());
+
+  priority_queue(const priority_queue& other) = default;
+  priority_queue(priority_queue&& other) noexcept = default;
+  ~priority_queue() = default;
+  priority_queue& operator=(const priority_queue& other) = default;
+  priority_queue& operator=(priority_queue&& other) noexcept = default;
+
+  [[nodiscard]] bool empty() const noexcept { return base_.empty(); }
+  [[nodiscard]] size_type size() const noexcept { return base_.size(); }
+
+  const_reference top() const { return base_[0]; }
+
+  void push(const_reference value);
+  void push(value_type&& value);
+  template <class... Args>
+  void emplace(Args&&... args);
+  void pop();
+  void pop_push(const_reference value);
+  void pop_push(value_type&& value);
+
+  void reserve(size_type n) { base_.reserve(n); }
+  void swap(priority_queue& other) noexcept;
+
+ private:
+  static size_type parent(size_type i) noexcept { return (i - 1) / Arity; }
+  static size_type first_child(size_type i) noexcept { return i * Arity + 1; }
+
+  void make_heap();
+  void sift_up(size_type i);
+  void sift_down(size_type i);
+
+  Container base_;
+  [[no_unique_address]] Compare comp_;
+};
+
+template <class T, class Compare, class Container, std::size_t Arity>
+priority_queue<T, Compare, Container, Arity>::priority_queue(
+    std::initializer_list<value_type> items, const Compare& comp)
+    : priority_queue(items.begin(), items.end(), comp) {}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+template <class InputIt>
+priority_queue<T, Compare, Container, Arity>::priority_queue(
+    InputIt first, InputIt last, const Compare& comp)
+    : comp_(comp) {
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                  typename std::iterator_traits<
+                                      InputIt>::iterator_category>) {
+    base_.reserve(static_cast<size_type>(std::distance(first, last)));
+  }
+  for (; first != last; ++first) base_.push_back(*first);
+  make_heap();
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+priority_queue<T, Compare, Container, Arity>::priority_queue(
+    Container&& base, const Compare& comp)
+    : base_(std::move(base)), comp_(comp) {
+  make_heap();
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+void priority_queue<T, Compare, Container, Arity>::push(
+    const_reference value) {
+  base_.push_back(value);
+  sift_up(base_.size() - 1);
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+void priority_queue<T, Compare, Container, Arity>::push(value_type&& value) {
+  base_.push_back(std::move(value));
+  sift_up(base_.size() - 1);
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+template <class... Args>
+void priority_queue<T, Compare, Container, Arity>::emplace(Args&&... args) {
+  base_.emplace_back(std::forward<Args>(args)...);
+  sift_up(base_.size() - 1);
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+void priority_queue<T, Compare, Container, Arity>::pop() {
+  if (base_.empty()) return;
+  if (base_.size() > 1) base_[0] = std::move(base_.back());
+  base_.pop_back();
+  if (!base_.empty()) sift_down(0);
+}
+
+// Replaces the top element and restores the heap with a single sift-down,
+// which is cheaper than pop() followed by push().
+template <class T, class Compare, class Container, std::size_t Arity>
+void priority_queue<T, Compare, Container, Arity>::pop_push(
+    const_reference value) {
+  if (base_.empty()) return push(value);
+  base_[0] = value;
+  sift_down(0);
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+void priority_queue<T, Compare, Container, Arity>::pop_push(
+    value_type&& value) {
+  if (base_.empty()) return push(std::move(value));
+  base_[0] = std::move(value);
+  sift_down(0);
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+void priority_queue<T, Compare, Container, Arity>::swap(
+    priority_queue& other) noexcept {
+  using std::swap;
+  base_.swap(other.base_);
+  swap(comp_, other.comp_);
+}
+
+// Floyd's bottom-up construction: O(n) total work.
+template <class T, class Compare, class Container, std::size_t Arity>
+void priority_queue<T, Compare, Container, Arity>::make_heap() {
+  const size_type n = base_.size();
+  if (n < 2) return;
+  for (size_type i = parent(n - 1) + 1; i-- > 0;) sift_down(i);
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+void priority_queue<T, Compare, Container, Arity>::sift_up(size_type i) {
+  value_type hole = std::move(base_[i]);
+  while (i > 0) {
+    const size_type p = parent(i);
+    if (!comp_(base_[p], hole)) break;
+    base_[i] = std::move(base_[p]);
+    i = p;
+  }
+  base_[i] = std::move(hole);
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+void priority_queue<T, Compare, Container, Arity>::sift_down(size_type i) {
+  const size_type n = base_.size();
+  value_type hole = std::move(base_[i]);
+  for (;;) {
+    const size_type first = first_child(i);
+    if (first >= n) break;
+    const size_type last = (n - first > Arity) ? first + Arity : n;
+    size_type best = first;
+    for (size_type c = first + 1; c < last; ++c) {
+      if (comp_(base_[best], base_[c])) best = c;
+    }
+    if (!comp_(hole, base_[best])) break;
+    base_[i] = std::move(base_[best]);
+    i = best;
+  }
+  base_[i] = std::move(hole);
+}
+
+}  // namespace s21
@@ -1,20 +1,21 @@
 #pragma once
 #include <initializer_list>
 
-#include "../seq/s21_list.h"
+#include "../seq/s21_ring_buffer.h"
 
 namespace s21 {
 
-template <class T>
+template <class T, class Container = ring_buffer<T>>
 class queue {
  public:
+  using container_type = Container;
   using value_type = T;
-  using size_type = std::size_t;
+  using size_type = typename Container::size_type;
   using reference = value_type&;
   using const_reference = const value_type&;
 
  private:
-  list<T> base_;
+  Container base_;
 
  public:
   queue() = default;
@@ -22,6 +23,8 @@ class queue {
   queue(std::initializer_list<value_type> items) {
     for (const auto& x : items) base_.push_back(x);
   }
+  explicit queue(const Container& base) : base_(base) {}
+  explicit queue(Container&& base) : base_(std::move(base)) {}
 
   queue(const queue& other) = default;
   queue& operator=(const queue& other) = default;
@@ -31,18 +34,62 @@ class queue {
 
   bool empty() const noexcept { return base_.empty(); }
   size_type size() const noexcept { return base_.size(); }
+  size_type capacity() const noexcept
+    requires requires(const Container& c) { c.capacity(); }
+  {
+    return base_.capacity();
+  }
+  void reserve(size_type n)
+    requires requires(Container& c) { c.reserve(size_type{}); }
+  {
+    base_.reserve(n);
+  }
 
+  reference front() { return base_.front(); }
   const_reference front() const { return base_.front(); }
+  reference back() { return base_.back(); }
   const_reference back() const { return base_.back(); }
 
   void push(const_reference value) { base_.push_back(value); }
+  void push(value_type&& value) { base_.push_back(std::move(value)); }
+  template <class... Args>
+  reference emplace(Args&&... args) {
+    return base_.emplace_back(std::forward<Args>(args)...);
+  }
   void pop() { base_.pop_front(); }
   void swap(queue& other) noexcept { base_.swap(other.base_); }
 
+  template <class InputIt>
+  void push_range(InputIt first, InputIt last) {
+    if constexpr (requires { base_.push_range(first, last); }) {
+      base_.push_range(first, last);
+    } else {
+      for (; first != last; ++first) base_.push_back(*first);
+    }
+  }
+  size_type pop_n(value_type* out, size_type n) {
+    if constexpr (requires { base_.pop_front_n(out, n); }) {
+      return base_.pop_front_n(out, n);
+    } else {
+      size_type taken = 0;
+      for (; taken < n && !base_.empty(); ++taken) {
+        out[taken] = std::move(base_.front());
+        base_.pop_front();
+      }
+      return taken;
+    }
+  }
+
   template <class... Args>
   void insert_many_back(Args&&... args) {
-    base_.insert_many_back(std::forward<Args>(args)...);
+    if constexpr (requires {
+                    base_.insert_many_back(std::forward<Args>(args)...);
+                  }) {
+      base_.insert_many_back(std::forward<Args>(args)...);
+    } else {
+      (base_.push_back(std::forward<Args>(args)), ...);
+    }
   }
 };
 
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
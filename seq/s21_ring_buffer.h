@@ -0,0 +1,292 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Contiguous circular buffer. Capacity is always a power of two so that
+// logical indices wrap with a mask instead of a division.
+template <class T>
+class ring_buffer {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+
+  ring_buffer() noexcept = default;
+  ring_buffer(std::initializer_list<value_type> items);
+  ring_buffer(const ring_buffer& other);
+  ring_buffer(ring_buffer&& other) noexcept;
+  ~ring_buffer() noexcept;
+
+  ring_buffer& operator=(const ring_buffer& other);
+  ring_buffer& operator=(ring_buffer&& other) noexcept;
+
+  reference operator[](size_type pos) noexcept {
+    return data_[(head_ + pos) & mask()];
+  }
+  const_reference operator[](size_type pos) const noexcept {
+    return data_[(head_ + pos) & mask()];
+  }
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+
+  reference front() { return data_[head_]; }
+  const_reference front() const { return data_[head_]; }
+  reference back() { return (*this)[size_ - 1]; }
+  const_reference back() const { return (*this)[size_ - 1]; }
+
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+  [[nodiscard]] size_type size() const noexcept { return size_; }
+  [[nodiscard]] size_type capacity() const noexcept { return cap_; }
+  [[nodiscard]] size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+  }
+  void reserve(size_type new_cap);
+
+  void clear() noexcept;
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type&& value) { emplace_back(std::move(value)); }
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(value_type&& value) { emplace_front(std::move(value)); }
+  void pop_back();
+  void pop_front();
+  void swap(ring_buffer& other) noexcept;
+
+  template <class... Args>
+  reference emplace_back(Args&&... args);
+  template <class... Args>
+  reference emplace_front(Args&&... args);
+
+  template <class InputIt>
+  void push_range(InputIt first, InputIt last);
+  size_type pop_front_n(value_type* out, size_type n);
+
+  template <class... Args>
+  void insert_many_back(Args&&... args);
+
+ private:
+  size_type mask() const noexcept { return cap_ - 1; }
+  void grow_to_fit(size_type n);
+  void reallocate(size_type new_cap);
+  static size_type round_up_pow2(size_type n) noexcept;
+
+  T* data_ = nullptr;
+  size_type head_ = 0;
+  size_type size_ = 0;
+  size_type cap_ = 0;
+};
+
+template <class T>
+ring_buffer<T>::ring_buffer(std::initializer_list<value_type> items) {
+  reserve(items.size());
+  for (const auto& x : items) emplace_back(x);
+}
+
+template <class T>
+ring_buffer<T>::ring_buffer(const ring_buffer& other) {
+  reserve(other.size_);
+  for (size_type i = 0; i < other.size_; ++i) emplace_back(other[i]);
+}
+
+template <class T>
+ring_buffer<T>::ring_buffer(ring_buffer&& other) noexcept
+    : data_(other.data_),
+      head_(other.head_),
+      size_(other.size_),
+      cap_(other.cap_) {
+  other.data_ = nullptr;
+  other.head_ = other.size_ = other.cap_ = 0;
+}
+
+template <class T>
+ring_buffer<T>::~ring_buffer() noexcept {
+  clear();
+  std::allocator<T>().deallocate(data_, cap_);
+}
+
+template <class T>
+ring_buffer<T>& ring_buffer<T>::operator=(const ring_buffer& other) {
+  if (this == &other) return *this;
+  ring_buffer tmp(other);
+  swap(tmp);
+  return *this;
+}
+
+template <class T>
+ring_buffer<T>& ring_buffer<T>::operator=(ring_buffer&& other) noexcept {
+  if (this == &other) return *this;
+  ring_buffer tmp(std::move(other));
+  swap(tmp);
+  return *this;
+}
+
+template <class T>
+typename ring_buffer<T>::reference ring_buffer<T>::at(size_type pos) {
+  if (pos >= size_)
+    throw std::out_of_range("s21::ring_buffer::at: index out of range");
+  return (*this)[pos];
+}
+
+template <class T>
+typename ring_buffer<T>::const_reference ring_buffer<T>::at(
+    size_type pos) const {
+  if (pos >= size_)
+    throw std::out_of_range("s21::ring_buffer::at: index out of range");
+  return (*this)[pos];
+}
+
+template <class T>
+typename ring_buffer<T>::size_type ring_buffer<T>::round_up_pow2(
+    size_type n) noexcept {
+  size_type p = 1;
+  while (p < n) p <<= 1;
+  return p;
+}
+
+template <class T>
+void ring_buffer<T>::reserve(size_type new_cap) {
+  if (new_cap > cap_) reallocate(round_up_pow2(new_cap));
+}
+
+template <class T>
+void ring_buffer<T>::grow_to_fit(size_type n) {
+  if (n <= cap_) return;
+  size_type new_cap = (cap_ == 0 ? 8 : cap_ * 2);
+  while (new_cap < n) new_cap *= 2;
+  reallocate(new_cap);
+}
+
+template <class T>
+void ring_buffer<T>::reallocate(size_type new_cap) {
+  std::allocator<T> alloc;
+  T* new_data = alloc.allocate(new_cap);
+  for (size_type i = 0; i < size_; ++i) {
+    T& src = (*this)[i];
+    std::construct_at(new_data + i, std::move_if_noexcept(src));
+    std::destroy_at(&src);
+  }
+  alloc.deallocate(data_, cap_);
+  data_ = new_data;
+  head_ = 0;
+  cap_ = new_cap;
+}
+
+template <class T>
+void ring_buffer<T>::clear() noexcept {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    for (size_type i = 0; i < size_; ++i) std::destroy_at(&(*this)[i]);
+  }
+  head_ = 0;
+  size_ = 0;
+}
+
+template <class T>
+template <class... Args>
+typename ring_buffer<T>::reference ring_buffer<T>::emplace_back(
+    Args&&... args) {
+  if (size_ == cap_) {
+    T tmp(std::forward<Args>(args)...);
+    grow_to_fit(size_ + 1);
+    return emplace_back(std::move(tmp));
+  }
+  T* slot = &data_[(head_ + size_) & mask()];
+  std::construct_at(slot, std::forward<Args>(args)...);
+  ++size_;
+  return *slot;
+}
+
+template <class T>
+template <class... Args>
+typename ring_buffer<T>::reference ring_buffer<T>::emplace_front(
+    Args&&... args) {
+  if (size_ == cap_) {
+    T tmp(std::forward<Args>(args)...);
+    grow_to_fit(size_ + 1);
+    return emplace_front(std::move(tmp));
+  }
+  const size_type new_head = (head_ - 1) & mask();
+  std::construct_at(data_ + new_head, std::forward<Args>(args)...);
+  head_ = new_head;
+  ++size_;
+  return data_[head_];
+}
+
+template <class T>
+void ring_buffer<T>::pop_back() {
+  if (empty()) return;
+  std::destroy_at(&back());
+  --size_;
+}
+
+template <class T>
+void ring_buffer<T>::pop_front() {
+  if (empty()) return;
+  std::destroy_at(data_ + head_);
+  head_ = (head_ + 1) & mask();
+  --size_;
+}
+
+template <class T>
+void ring_buffer<T>::swap(ring_buffer& other) noexcept {
+  using std::swap;
+  swap(data_, other.data_);
+  swap(head_, other.head_);
+  swap(size_, other.size_);
+  swap(cap_, other.cap_);
+}
+
+template <class T>
+template <class InputIt>
+void ring_buffer<T>::push_range(InputIt first, InputIt last) {
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                  typename std::iterator_traits<
+                                      InputIt>::iterator_category>) {
+    grow_to_fit(size_ + static_cast<size_type>(std::distance(first, last)));
+  }
+  for (; first != last; ++first) emplace_back(*first);
+}
+
+// Moves up to n elements from the front into out and returns how many were
+// taken. Trivially copyable payloads are copied with at most two memcpy calls;
+// others are popped one at a time, so a throwing move-assignment leaves the
+// elements not yet taken in place.
+template <class T>
+typename ring_buffer<T>::size_type ring_buffer<T>::pop_front_n(value_type* out,
+                                                               size_type n) {
+  if (n > size_) n = size_;
+  if (n == 0) return 0;
+
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    const size_type first_part = std::min(n, cap_ - head_);
+    std::memcpy(out, data_ + head_, first_part * sizeof(T));
+    std::memcpy(out + first_part, data_, (n - first_part) * sizeof(T));
+    head_ = (head_ + n) & mask();
+    size_ -= n;
+  } else {
+    for (size_type i = 0; i < n; ++i) {
+      out[i] = std::move(front());
+      pop_front();
+    }
+  }
+  return n;
+}
+
+template <class T>
+template <class... Args>
+void ring_buffer<T>::insert_many_back(Args&&... args) {
+  grow_to_fit(size_ + sizeof...(args));
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+}  // namespace s21
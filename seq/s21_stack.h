@@ -1,25 +1,32 @@
 #pragma once
 #include <initializer_list>
+#include <type_traits>
+#include <utility>
 
-#include "../seq/s21_list.h"
+#include "../seq/s21_vector.h"
 
 namespace s21 {
 
-template <class T>
+template <class T, class Container = vector<T>>
 class stack {
  public:
+  using container_type = Container;
   using value_type = T;
-  using size_type = std::size_t;
+  using size_type = typename Container::size_type;
   using reference = value_type&;
   using const_reference = const value_type&;
+  // Depth returned by mark() and accepted by rollback_to().
+  using checkpoint = size_type;
 
  private:
-  list<T> base_;
+  Container base_;
 
  public:
   stack() = default;
 
   stack(std::initializer_list<value_type> items);
+  explicit stack(const Container& base) : base_(base) {}
+  explicit stack(Container&& base) : base_(std::move(base)) {}
 
   stack(const stack& other) = default;
   stack& operator=(const stack& other) = default;
@@ -33,55 +40,113 @@ class stack {
   bool empty() const noexcept;
   size_type size() const noexcept;
 
+  reference top();
   const_reference top() const;
 
   void push(const_reference value);
+  void push(value_type&& value);
+  template <class... Args>
+  reference emplace(Args&&... args);
   void pop();
   void swap(stack& other) noexcept;
 
+  checkpoint mark() const noexcept { return base_.size(); }
+  void rollback_to(checkpoint depth);
+  template <class Undo>
+  void rollback_to(checkpoint depth, Undo&& undo);
+
   template <class... Args>
   void insert_many_back(Args&&... args);
 };
 
-template <class T>
-stack<T>::stack(std::initializer_list<value_type> items) {
+template <class T, class Container>
+stack<T, Container>::stack(std::initializer_list<value_type> items) {
   for (const auto& x : items) base_.push_back(x);
 }
 
-template <class T>
-bool stack<T>::empty() const noexcept {
+template <class T, class Container>
+bool stack<T, Container>::empty() const noexcept {
   return base_.empty();
 }
 
-template <class T>
-typename stack<T>::size_type stack<T>::size() const noexcept {
+template <class T, class Container>
+typename stack<T, Container>::size_type stack<T, Container>::size()
+    const noexcept {
   return base_.size();
 }
 
-template <class T>
-typename stack<T>::const_reference stack<T>::top() const {
+template <class T, class Container>
+typename stack<T, Container>::reference stack<T, Container>::top() {
   return base_.back();
 }
 
-template <class T>
-void stack<T>::push(const_reference value) {
+template <class T, class Container>
+typename stack<T, Container>::const_reference stack<T, Container>::top()
+    const {
+  return base_.back();
+}
+
+template <class T, class Container>
+void stack<T, Container>::push(const_reference value) {
   base_.push_back(value);
 }
 
-template <class T>
-void stack<T>::pop() {
+template <class T, class Container>
+void stack<T, Container>::push(value_type&& value) {
+  base_.push_back(std::move(value));
+}
+
+template <class T, class Container>
+template <class... Args>
+typename stack<T, Container>::reference stack<T, Container>::emplace(
+    Args&&... args) {
+  return base_.emplace_back(std::forward<Args>(args)...);
+}
+
+template <class T, class Container>
+void stack<T, Container>::pop() {
   base_.pop_back();
 }
 
-template <class T>
-void stack<T>::swap(stack& other) noexcept {
+template <class T, class Container>
+void stack<T, Container>::swap(stack& other) noexcept {
   base_.swap(other.base_);
 }
 
-template <class T>
+// Drops everything pushed after mark() returned depth. Trivially
+// destructible elements on a resizable container are discarded by moving
+// the end, so the cost does not depend on how many entries are undone.
+template <class T, class Container>
+void stack<T, Container>::rollback_to(checkpoint depth) {
+  if (depth >= base_.size()) return;
+  if constexpr (std::is_trivially_destructible_v<T> &&
+                requires { base_.resize(depth); }) {
+    base_.resize(depth);
+  } else {
+    while (base_.size() > depth) base_.pop_back();
+  }
+}
+
+// Same, but hands every dropped entry to undo(entry), newest first.
+template <class T, class Container>
+template <class Undo>
+void stack<T, Container>::rollback_to(checkpoint depth, Undo&& undo) {
+  while (base_.size() > depth) {
+    undo(base_.back());
+    base_.pop_back();
+  }
+}
+
+template <class T, class Container>
 template <class... Args>
-void stack<T>::insert_many_back(Args&&... args) {
-  base_.insert_many_back(std::forward<Args>(args)...);
+void stack<T, Container>::insert_many_back(Args&&... args) {
+  if constexpr (requires {
+                  base_.insert_many_back(std::forward<Args>(args)...);
+                }) {
+    base_.insert_many_back(std::forward<Args>(args)...);
+  } else {
+    (base_.push_back(std::forward<Args>(args)), ...);
+  }
 }
 
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
@@ -0,0 +1,288 @@
+#pragma once
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Vector with a fixed capacity N stored inline: it never allocates and
+// throws std::length_error instead of growing. Slots past size() are left
+// unconstructed. For trivial T the storage is a plain T[N] and every member
+// is constexpr; copies, moves and destruction are then the implicit
+// trivial ones, so the whole object is trivially copyable.
+template <class T, std::size_t N>
+class static_vector {
+  static constexpr bool kTrivial =
+      std::is_trivially_copyable_v<T> &&
+      std::is_trivially_default_constructible_v<T>;
+  static constexpr std::size_t kSlots = N == 0 ? 1 : N;
+
+  struct RawStorage {
+    alignas(T) unsigned char bytes[sizeof(T) * kSlots];
+  };
+  using Storage = std::conditional_t<kTrivial, T[kSlots], RawStorage>;
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+
+  constexpr static_vector() noexcept {
+    // Constant evaluation may not read indeterminate values, not even
+    // through an implicit copy, so give the unused slots a value there.
+    if constexpr (kTrivial) {
+      if (std::is_constant_evaluated()) {
+        for (size_type i = 0; i < kSlots; ++i) storage_[i] = T();
+      }
+    }
+  }
+  constexpr explicit static_vector(size_type n) : static_vector() {
+    check_fits(n);
+    for (; size_ < n; ++size_) construct(size_);
+  }
+  constexpr static_vector(std::initializer_list<value_type> items)
+      : static_vector() {
+    check_fits(items.size());
+    for (const auto& x : items) construct(size_++, x);
+  }
+
+  constexpr static_vector(const static_vector&) requires kTrivial = default;
+  constexpr static_vector(const static_vector& other) requires(!kTrivial) {
+    for (; size_ < other.size_; ++size_) construct(size_, other[size_]);
+  }
+  constexpr static_vector(static_vector&&) noexcept requires kTrivial =
+      default;
+  constexpr static_vector(static_vector&& other) noexcept(
+      std::is_nothrow_move_constructible_v<T>) requires(!kTrivial) {
+    for (; size_ < other.size_; ++size_)
+      construct(size_, std::move(other[size_]));
+    other.clear();
+  }
+
+  constexpr static_vector& operator=(const static_vector&) requires kTrivial =
+      default;
+  constexpr static_vector& operator=(const static_vector& other) requires(
+      !kTrivial) {
+    if (this != &other) {
+      clear();
+      for (; size_ < other.size_; ++size_) construct(size_, other[size_]);
+    }
+    return *this;
+  }
+  constexpr static_vector& operator=(static_vector&&) noexcept requires
+      kTrivial = default;
+  constexpr static_vector& operator=(static_vector&& other) noexcept(
+      std::is_nothrow_move_constructible_v<T>) requires(!kTrivial) {
+    if (this != &other) {
+      clear();
+      for (; size_ < other.size_; ++size_)
+        construct(size_, std::move(other[size_]));
+      other.clear();
+    }
+    return *this;
+  }
+
+  constexpr ~static_vector() requires kTrivial = default;
+  constexpr ~static_vector() requires(!kTrivial) { clear(); }
+
+  constexpr reference operator[](size_type pos) noexcept {
+    return data()[pos];
+  }
+  constexpr const_reference operator[](size_type pos) const noexcept {
+    return data()[pos];
+  }
+  constexpr reference at(size_type pos) {
+    if (pos >= size_)
+      throw std::out_of_range("s21::static_vector::at: index out of range");
+    return data()[pos];
+  }
+  constexpr const_reference at(size_type pos) const {
+    if (pos >= size_)
+      throw std::out_of_range("s21::static_vector::at: index out of range");
+    return data()[pos];
+  }
+
+  constexpr reference front() { return data()[0]; }
+  constexpr const_reference front() const { return data()[0]; }
+  constexpr reference back() { return data()[size_ - 1]; }
+  constexpr const_reference back() const { return data()[size_ - 1]; }
+
+  constexpr value_type* data() noexcept {
+    if constexpr (kTrivial)
+      return storage_;
+    else
+      return std::launder(reinterpret_cast<T*>(storage_.bytes));
+  }
+  constexpr const value_type* data() const noexcept {
+    if constexpr (kTrivial)
+      return storage_;
+    else
+      return std::launder(reinterpret_cast<const T*>(storage_.bytes));
+  }
+
+  constexpr iterator begin() noexcept { return data(); }
+  constexpr const_iterator begin() const noexcept { return data(); }
+  constexpr const_iterator cbegin() const noexcept { return data(); }
+  constexpr iterator end() noexcept { return data() + size_; }
+  constexpr const_iterator end() const noexcept { return data() + size_; }
+  constexpr const_iterator cend() const noexcept { return end(); }
+
+  [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+  [[nodiscard]] constexpr bool full() const noexcept { return size_ == N; }
+  [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+  [[nodiscard]] static constexpr size_type capacity() noexcept { return N; }
+  [[nodiscard]] static constexpr size_type max_size() noexcept { return N; }
+  constexpr void reserve(size_type new_cap) const { check_fits(new_cap); }
+  constexpr void shrink_to_fit() const noexcept {}
+
+  constexpr void clear() noexcept {
+    while (size_ != 0) destroy(--size_);
+  }
+  constexpr void resize(size_type count);
+  constexpr void resize(size_type count, const_reference value);
+
+  constexpr iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+  constexpr iterator insert(const_iterator pos, value_type&& value) {
+    return emplace(pos, std::move(value));
+  }
+  template <class... Args>
+  constexpr iterator emplace(const_iterator pos, Args&&... args);
+  constexpr void erase(const_iterator pos);
+
+  constexpr void push_back(const_reference value) { emplace_back(value); }
+  constexpr void push_back(value_type&& value) {
+    emplace_back(std::move(value));
+  }
+  template <class... Args>
+  constexpr reference emplace_back(Args&&... args);
+  constexpr void pop_back() {
+    if (size_ != 0) destroy(--size_);
+  }
+
+  constexpr void swap(static_vector& other) noexcept(
+      std::is_nothrow_swappable_v<T> &&
+      std::is_nothrow_move_constructible_v<T>);
+
+  template <class... Args>
+  constexpr iterator insert_many(const_iterator pos, Args&&... args);
+  template <class... Args>
+  constexpr void insert_many_back(Args&&... args);
+
+ private:
+  static constexpr void check_fits(size_type n) {
+    if (n > N)
+      throw std::length_error("s21::static_vector: capacity exceeded");
+  }
+
+  template <class... Args>
+  constexpr void construct(size_type i, Args&&... args) {
+    if constexpr (kTrivial)
+      storage_[i] = T(std::forward<Args>(args)...);
+    else
+      ::new (static_cast<void*>(storage_.bytes + i * sizeof(T)))
+          T(std::forward<Args>(args)...);
+  }
+  constexpr void destroy(size_type i) noexcept {
+    if constexpr (!kTrivial) std::destroy_at(data() + i);
+  }
+
+  Storage storage_;
+  size_type size_ = 0;
+};
+
+template <class T, std::size_t N>
+constexpr void static_vector<T, N>::resize(size_type count) {
+  check_fits(count);
+  while (size_ > count) destroy(--size_);
+  for (; size_ < count; ++size_) construct(size_);
+}
+
+template <class T, std::size_t N>
+constexpr void static_vector<T, N>::resize(size_type count,
+                                           const_reference value) {
+  check_fits(count);
+  while (size_ > count) destroy(--size_);
+  for (; size_ < count; ++size_) construct(size_, value);
+}
+
+template <class T, std::size_t N>
+template <class... Args>
+constexpr typename static_vector<T, N>::iterator static_vector<T, N>::emplace(
+    const_iterator pos, Args&&... args) {
+  const size_type idx = static_cast<size_type>(pos - cbegin());
+  check_fits(size_ + 1);
+  // Build the value first: args may refer to an element that is shifted.
+  value_type tmp(std::forward<Args>(args)...);
+  if (idx == size_) {
+    construct(size_, std::move(tmp));
+  } else {
+    construct(size_, std::move(data()[size_ - 1]));
+    for (size_type i = size_ - 1; i > idx; --i)
+      data()[i] = std::move(data()[i - 1]);
+    data()[idx] = std::move(tmp);
+  }
+  ++size_;
+  return begin() + idx;
+}
+
+template <class T, std::size_t N>
+constexpr void static_vector<T, N>::erase(const_iterator pos) {
+  if (size_ == 0) return;
+  const size_type idx = static_cast<size_type>(pos - cbegin());
+  for (size_type i = idx; i + 1 < size_; ++i)
+    data()[i] = std::move(data()[i + 1]);
+  destroy(--size_);
+}
+
+template <class T, std::size_t N>
+template <class... Args>
+constexpr typename static_vector<T, N>::reference
+static_vector<T, N>::emplace_back(Args&&... args) {
+  check_fits(size_ + 1);
+  construct(size_, std::forward<Args>(args)...);
+  return data()[size_++];
+}
+
+template <class T, std::size_t N>
+constexpr void static_vector<T, N>::swap(static_vector& other) noexcept(
+    std::is_nothrow_swappable_v<T> &&
+    std::is_nothrow_move_constructible_v<T>) {
+  static_vector& longer = size_ < other.size_ ? other : *this;
+  static_vector& shorter = size_ < other.size_ ? *this : other;
+  const size_type common = shorter.size_;
+  using std::swap;
+  for (size_type i = 0; i < common; ++i) swap(data()[i], other[i]);
+  for (size_type i = common; i < longer.size_; ++i)
+    shorter.construct(i, std::move(longer[i]));
+  shorter.size_ = longer.size_;
+  while (longer.size_ > common) longer.destroy(--longer.size_);
+}
+
+template <class T, std::size_t N>
+template <class... Args>
+constexpr typename static_vector<T, N>::iterator
+static_vector<T, N>::insert_many(const_iterator pos, Args&&... args) {
+  const size_type idx = static_cast<size_type>(pos - cbegin());
+  check_fits(size_ + sizeof...(args));
+  size_type j = idx;
+  (emplace(cbegin() + j++, std::forward<Args>(args)), ...);
+  return begin() + idx;
+}
+
+template <class T, std::size_t N>
+template <class... Args>
+constexpr void static_vector<T, N>::insert_many_back(Args&&... args) {
+  check_fits(size_ + sizeof...(args));
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+}  // namespace s21
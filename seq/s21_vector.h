@@ -3,6 +3,7 @@
 #include <initializer_list>
 #include <limits>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
 namespace s21 {
@@ -52,8 +53,10 @@ class vector {
   [[nodiscard]] size_type max_size() const noexcept;
   void reserve(size_type new_cap);
   void shrink_to_fit();
+  void resize(size_type count);
+  void resize(size_type count, const_reference value);
 
-  void clear() noexcept;
+  void clear();
   iterator insert(iterator pos, const_reference value);
   iterator insert(const_iterator pos, const_reference value) {
     const size_type idx = static_cast<size_type>(pos - cbegin());
@@ -61,6 +64,9 @@ class vector {
   }
   void erase(iterator pos);
   void push_back(const_reference value);
+  void push_back(value_type&& value);
+  template <class... Args>
+  reference emplace_back(Args&&... args);
   void pop_back();
   void swap(vector& other) noexcept;
   void reallocate(size_type new_cap);
@@ -197,6 +203,29 @@ void vector<T>::shrink_to_fit() {
   if (size_ < cap_) reallocate(size_);
 }
 
+template <class T>
+void vector<T>::resize(size_type count) {
+  resize(count, value_type());
+}
+
+template <class T>
+void vector<T>::resize(size_type count, const_reference value) {
+  if (count > size_) {
+    if (count > cap_) {
+      value_type tmp(value);
+      reallocate(count > cap_ * 2 ? count : cap_ * 2);
+      for (size_type i = size_; i < count; ++i) data_[i] = tmp;
+    } else {
+      for (size_type i = size_; i < count; ++i) data_[i] = value;
+    }
+  }
+  // Shrinking releases the dropped elements, like pop_back.
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    for (size_type i = count; i < size_; ++i) data_[i] = value_type();
+  }
+  size_ = count;
+}
+
 template <class T>
 void vector<T>::push_back(const_reference value) {
   if (size_ == cap_) {
@@ -207,9 +236,52 @@ void vector<T>::push_back(const_reference value) {
   ++size_;
 }
 
+template <class T>
+void vector<T>::push_back(value_type&& value) {
+  if (size_ == cap_) {
+    value_type tmp(std::move(value));
+    reallocate(cap_ == 0 ? 1 : cap_ * 2);
+    data_[size_] = std::move(tmp);
+  } else {
+    data_[size_] = std::move(value);
+  }
+  ++size_;
+}
+
+template <class T>
+template <class... Args>
+typename vector<T>::reference vector<T>::emplace_back(Args&&... args) {
+  value_type tmp(std::forward<Args>(args)...);
+  push_back(std::move(tmp));
+  return data_[size_ - 1];
+}
+
+// Every slot up to cap_ holds a live object (new[] built them and delete[]
+// destroys them), so a removed element is released by assigning a fresh
+// value_type() rather than by destroy_at. Trivially destructible elements
+// hold nothing to release, so for them removal only moves the end.
 template <class T>
 void vector<T>::pop_back() {
-  if (size_ != 0) --size_;
+  if (size_ == 0) return;
+  --size_;
+  if constexpr (!std::is_trivially_destructible_v<T>)
+    data_[size_] = value_type();
+}
+
+template <class T>
+void vector<T>::clear() {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    while (size_ != 0) data_[--size_] = value_type();
+  }
+  size_ = 0;
+}
+
+template <class T>
+void vector<T>::swap(vector& other) noexcept {
+  using std::swap;
+  swap(data_, other.data_);
+  swap(size_, other.size_);
+  swap(cap_, other.cap_);
 }
 
 template <class T>
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "../s21_containersplus.h"
+
+namespace {
+
+constexpr s21::array<std::uint32_t, 256> make_crc_table() {
+  s21::array<std::uint32_t, 256> table{};
+  for (std::uint32_t i = 0; i < 256; ++i) {
+    std::uint32_t c = i;
+    for (int k = 0; k < 8; ++k) c = (c & 1u) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+    table[i] = c;
+  }
+  return table;
+}
+
+constexpr auto kCrcTable = make_crc_table();
+
+std::uint32_t crc32(const std::string& s) {
+  std::uint32_t c = 0xFFFFFFFFu;
+  for (unsigned char ch : s) c = kCrcTable[(c ^ ch) & 0xFFu] ^ (c >> 8);
+  return c ^ 0xFFFFFFFFu;
+}
+
+}  // namespace
+
+TEST(ArrayConstexpr, IsAggregateAndTriviallyCopyable) {
+  static_assert(std::is_aggregate_v<s21::array<int, 4>>);
+  static_assert(std::is_trivially_copyable_v<s21::array<int, 4>>);
+  static_assert(sizeof(s21::array<int, 4>) == 4 * sizeof(int));
+  SUCCEED();
+}
+
+TEST(ArrayConstexpr, CompileTimeTable) {
+  static_assert(kCrcTable[0] == 0u);
+  static_assert(kCrcTable[1] == 0x77073096u);
+  static_assert(kCrcTable.size() == 256);
+  EXPECT_EQ(crc32("123456789"), 0xCBF43926u);
+}
+
+TEST(ArrayConstexpr, FillSwapAndAccessorsInConstantExpressions) {
+  constexpr auto folded = [] {
+    s21::array<int, 3> a{1, 2, 3};
+    s21::array<int, 3> b{};
+    b.fill(9);
+    a.swap(b);
+    int sum = 0;
+    for (int v : b) sum += v;
+    return sum * 100 + a.front() + a.back() + a.at(1);
+  }();
+  static_assert(folded == 600 + 27);
+  EXPECT_EQ(folded, 627);
+}
+
+TEST(ArrayConstexpr, ToArrayAndStructuredBindings) {
+  constexpr int raw[] = {4, 5, 6};
+  constexpr auto a = s21::to_array(raw);
+  static_assert(std::is_same_v<decltype(a), const s21::array<int, 3>>);
+  static_assert(s21::get<2>(a) == 6);
+
+  auto s = s21::to_array({std::string("x"), std::string("y")});
+  auto& [first, second] = s;
+  second = "z";
+  EXPECT_EQ(first, "x");
+  EXPECT_EQ(s[1], "z");
+
+  static_assert(std::tuple_size_v<s21::array<double, 7>> == 7);
+  static_assert(
+      std::is_same_v<std::tuple_element_t<1, s21::array<char, 2>>, char>);
+}
+
+TEST(ArrayConstexpr, ZeroLength) {
+  constexpr s21::array<int, 0> a{};
+  static_assert(a.empty());
+  static_assert(a.size() == 0);
+  EXPECT_EQ(a.begin(), a.end());
+
+  struct NoDefault {
+    explicit NoDefault(int) {}
+  };
+  s21::array<NoDefault, 0> none;
+  static_assert(std::is_empty_v<s21::array<NoDefault, 0>>);
+  EXPECT_EQ(none.begin(), none.end());
+  EXPECT_THROW(none.at(0), std::out_of_range);
+}
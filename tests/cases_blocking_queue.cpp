@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+using namespace std::chrono_literals;
+
+TEST(BlockingQueue, PushPopSingleThread) {
+  s21::blocking_queue<std::string> q;
+  EXPECT_TRUE(q.push("a"));
+  EXPECT_TRUE(q.emplace(2, 'b'));
+  EXPECT_EQ(q.size(), 2u);
+
+  std::string out;
+  EXPECT_TRUE(q.wait_pop(out));
+  EXPECT_EQ(out, "a");
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "bb");
+  EXPECT_FALSE(q.try_pop(out));
+}
+
+TEST(BlockingQueue, WaitPopForTimesOut) {
+  s21::blocking_queue<int> q;
+  int v = 0;
+  EXPECT_FALSE(q.wait_pop_for(v, 5ms));
+  q.push(7);
+  EXPECT_TRUE(q.wait_pop_for(v, 5ms));
+  EXPECT_EQ(v, 7);
+}
+
+TEST(BlockingQueue, BoundedTryPushFailsWhenFull) {
+  s21::blocking_queue<int> q(2);
+  EXPECT_TRUE(q.try_push(1));
+  EXPECT_TRUE(q.try_push(2));
+  EXPECT_FALSE(q.try_push(3));
+  int v = 0;
+  q.wait_pop(v);
+  EXPECT_TRUE(q.try_push(3));
+}
+
+TEST(BlockingQueue, CloseWakesWaitersAndDrains) {
+  s21::blocking_queue<int> q;
+  q.push(1);
+  std::atomic<int> popped{0};
+  std::thread consumer([&] {
+    int v = 0;
+    while (q.wait_pop(v)) ++popped;
+  });
+  std::this_thread::sleep_for(5ms);
+  q.close();
+  consumer.join();
+  EXPECT_EQ(popped.load(), 1);
+  EXPECT_TRUE(q.closed());
+  EXPECT_FALSE(q.push(2));
+}
+
+TEST(BlockingQueue, CloseReleasesBlockedProducer) {
+  s21::blocking_queue<int> q(1);
+  q.push(1);
+  std::thread producer([&] { EXPECT_FALSE(q.push(2)); });
+  std::this_thread::sleep_for(5ms);
+  q.close();
+  producer.join();
+  EXPECT_EQ(q.size(), 1u);
+}
+
+TEST(BlockingQueue, PopAllSwapsOutContents) {
+  s21::blocking_queue<int> q;
+  std::vector<int> src{1, 2, 3, 4};
+  EXPECT_EQ(q.push_bulk(src.begin(), src.end()), 4u);
+  auto drained = q.pop_all();
+  EXPECT_TRUE(q.empty());
+  ASSERT_EQ(drained.size(), 4u);
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(drained[i], i + 1);
+}
+
+TEST(BlockingQueue, BoundedQueueKeepsReservationAfterPopAll) {
+  s21::blocking_queue<int> q(8);
+  int out[4];
+  // Nothing to wait for when no item is wanted.
+  EXPECT_EQ(q.pop_bulk(out, 0), 0u);
+  q.push(1);
+  EXPECT_EQ(q.pop_all().size(), 1u);
+  q.push(2);
+  // The buffer swapped in by the first pop_all was reserved up front.
+  auto second = q.pop_all();
+  EXPECT_EQ(second.size(), 1u);
+  EXPECT_GE(second.capacity(), 8u);
+}
+
+TEST(BlockingQueue, BulkTransferThroughBoundedQueue) {
+  constexpr int kCount = 20000;
+  s21::blocking_queue<int> q(64);
+  std::thread producer([&] {
+    std::vector<int> batch(100);
+    for (int i = 0; i < kCount; i += 100) {
+      for (int j = 0; j < 100; ++j) batch[j] = i + j;
+      q.push_bulk(batch.begin(), batch.end());
+    }
+    q.close();
+  });
+  int out[32];
+  int expected = 0;
+  bool in_order = true;
+  while (std::size_t got = q.pop_bulk(out, 32)) {
+    for (std::size_t j = 0; j < got; ++j) in_order &= (out[j] == expected++);
+  }
+  producer.join();
+  EXPECT_TRUE(in_order);
+  EXPECT_EQ(expected, kCount);
+}
@@ -0,0 +1,340 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+
+// Orders by the first member only, so equal keys stay distinguishable.
+struct FirstLess {
+  bool operator()(const std::pair<int, int>& a,
+                  const std::pair<int, int>& b) const {
+    return a.first < b.first;
+  }
+};
+
+// 64-byte nodes hold four slots, so a few hundred elements already give a
+// deep tree with splits and merges at every level.
+// An int whose copies throw once the budget runs out; moves never throw.
+struct FlakyCopy {
+  static inline int budget = 1 << 30;
+  int value = 0;
+  explicit FlakyCopy(int v) : value(v) {}
+  FlakyCopy(const FlakyCopy& o) : value(o.value) {
+    if (budget-- == 0) throw std::runtime_error("copy");
+  }
+  FlakyCopy(FlakyCopy&&) noexcept = default;
+  FlakyCopy& operator=(const FlakyCopy&) = default;
+  FlakyCopy& operator=(FlakyCopy&&) noexcept = default;
+  bool operator<(const FlakyCopy& o) const { return value < o.value; }
+};
+
+using TinyTree = s21::BTree<int, int, std::less<int>,
+                            std::allocator<std::pair<const int, int>>, false,
+                            64>;
+using TinyMultiTree =
+    s21::BTree<std::pair<int, int>, void, FirstLess,
+               std::allocator<std::pair<int, int>>, true, 64>;
+
+template <class M>
+std::vector<std::pair<int, int>> items(const M& m) {
+  std::vector<std::pair<int, int>> out;
+  for (auto it = m.begin(); it != m.end(); ++it)
+    out.emplace_back((*it).first, (*it).second);
+  return out;
+}
+
+}  // namespace
+
+TEST(BTree, TinyNodesSurviveChurn) {
+  static_assert(TinyTree::kLeafSlots == 4 && TinyTree::kInnerSlots == 4);
+  TinyTree t;
+  std::map<int, int> ref;
+  std::mt19937 rng(11);
+  for (int step = 0; step < 20000; ++step) {
+    const int key = static_cast<int>(rng() % 600);
+    if (rng() % 3 != 0) {
+      const bool added = t.insert_unique(key, step).second;
+      ASSERT_EQ(added, ref.emplace(key, step).second);
+    } else {
+      auto it = t.find(key);
+      auto next = ref.upper_bound(key);
+      ASSERT_EQ(it != t.end(), ref.erase(key) == 1);
+      if (it == t.end()) continue;
+      auto after = t.erase(it);
+      if (next == ref.end()) {
+        ASSERT_EQ(after, t.end());
+      } else {
+        ASSERT_EQ(TinyTree::key_of(after), next->first);
+      }
+    }
+    if (step % 500 == 0) {
+      ASSERT_TRUE(t.verify()) << "step " << step;
+    }
+  }
+  EXPECT_TRUE(t.verify());
+  EXPECT_GE(t.height(), 3u);
+  ASSERT_EQ(t.size(), ref.size());
+  std::vector<std::pair<int, int>> expected(ref.begin(), ref.end());
+  EXPECT_EQ(items(t), expected);
+}
+
+TEST(BTree, SortedLoadsPackNodes) {
+  TinyTree up;
+  TinyTree down;
+  for (int i = 0; i < 1024; ++i) {
+    up.insert_unique(i, i);
+    down.insert_unique(-i, i);
+  }
+  ASSERT_TRUE(up.verify());
+  ASSERT_TRUE(down.verify());
+  // 256 full leaves under four-way internal nodes.
+  EXPECT_EQ(up.height(), 5u);
+  EXPECT_EQ(down.height(), 5u);
+
+  TinyTree copy(up);
+  EXPECT_TRUE(copy.verify());
+  EXPECT_EQ(items(copy), items(up));
+  for (int i = 0; i < 1024; i += 2) up.erase_key(i);
+  EXPECT_TRUE(up.verify());
+  EXPECT_EQ(up.size(), 512u);
+  EXPECT_EQ(copy.size(), 1024u);
+  while (!down.empty()) down.erase(down.begin());
+  EXPECT_TRUE(down.verify());
+  EXPECT_EQ(down.begin(), down.end());
+}
+
+TEST(BTree, EquivalentKeysKeepInsertionOrder) {
+  TinyMultiTree t;
+  std::multiset<std::pair<int, int>, FirstLess> ref;
+  std::mt19937 rng(3);
+  for (int step = 0; step < 5000; ++step) {
+    const std::pair<int, int> v{static_cast<int>(rng() % 40), step};
+    if (rng() % 4 != 0) {
+      t.insert_equal(v);
+      ref.insert(v);
+    } else {
+      auto it = t.lower_bound(v);
+      auto rit = ref.lower_bound(v);
+      if (it == t.end()) continue;
+      t.erase(it);
+      ref.erase(rit);
+    }
+  }
+  ASSERT_TRUE(t.verify());
+  ASSERT_EQ(t.size(), ref.size());
+  EXPECT_TRUE(std::equal(t.begin(), t.end(), ref.begin(), ref.end()));
+  EXPECT_EQ(t.count(std::pair<int, int>{7, 0}), ref.count({7, 0}));
+  EXPECT_EQ(t.erase_key(std::pair<int, int>{7, 0}), ref.erase({7, 0}));
+  EXPECT_TRUE(t.verify());
+}
+
+TEST(BTree, MapInterface) {
+  s21::btree_map<int, std::string> m{{2, "two"}, {1, "one"}};
+  EXPECT_EQ(m.at(1), "one");
+  EXPECT_THROW(m.at(3), std::out_of_range);
+  m[3] = "three";
+  EXPECT_FALSE(m.insert(3, "drei").second);
+  EXPECT_FALSE(m.insert_or_assign(3, "drei").second);
+  EXPECT_EQ(m[3], "drei");
+  EXPECT_TRUE(m.emplace(0, "zero").second);
+  EXPECT_EQ(m.begin()->second, "zero");
+  EXPECT_EQ((*m.lower_bound(2)).first, 2);
+  EXPECT_EQ((*m.upper_bound(2)).first, 3);
+  EXPECT_EQ(m.upper_bound(3), m.end());
+  EXPECT_EQ((*std::prev(m.end())).second, "drei");
+
+  auto res = m.insert_many(std::pair<const int, std::string>{5, "five"},
+                           std::pair<const int, std::string>{1, "uno"});
+  ASSERT_EQ(res.size(), 2u);
+  EXPECT_TRUE(res[0].second);
+  EXPECT_EQ(res[0].first->second, "five");
+  EXPECT_FALSE(res[1].second);
+  EXPECT_EQ(res[1].first->second, "one");
+
+  auto it = m.erase(m.find(2));
+  EXPECT_EQ(it->first, 3);
+  EXPECT_EQ(m.erase(42), 0u);
+  EXPECT_EQ(m.size(), 4u);
+  EXPECT_FALSE(m.contains(2));
+  EXPECT_EQ(m.count(5), 1u);
+}
+
+TEST(BTree, MergeLeavesDuplicatesBehind) {
+  s21::btree_map<int, int> a{{1, 1}, {3, 3}};
+  s21::btree_map<int, int> b{{2, 20}, {3, 30}, {4, 40}};
+  a.merge(b);
+  const std::vector<std::pair<int, int>> merged{
+      {1, 1}, {2, 20}, {3, 3}, {4, 40}};
+  const std::vector<std::pair<int, int>> left{{3, 30}};
+  EXPECT_EQ(items(a), merged);
+  EXPECT_EQ(items(b), left);
+
+  s21::btree_set<std::string> s{"a", "c"};
+  s21::btree_set<std::string> t{"b", "c"};
+  s.merge(t);
+  EXPECT_EQ(std::vector<std::string>(s.begin(), s.end()),
+            (std::vector<std::string>{"a", "b", "c"}));
+  EXPECT_EQ(std::vector<std::string>(t.begin(), t.end()),
+            (std::vector<std::string>{"c"}));
+
+  s21::btree_multiset<int> ms{1, 2};
+  s21::btree_multiset<int> other{2, 3};
+  ms.merge(other);
+  EXPECT_EQ(std::vector<int>(ms.begin(), ms.end()),
+            (std::vector<int>{1, 2, 2, 3}));
+  EXPECT_TRUE(other.empty());
+}
+
+TEST(BTree, ThrowingMergeChangesNeither) {
+  s21::btree_map<int, FlakyCopy> a;
+  s21::btree_map<int, FlakyCopy> b;
+  for (int i = 0; i < 300; i += 3) a.insert(i, FlakyCopy(i));
+  for (int i = 0; i < 300; i += 2) b.insert(i, FlakyCopy(-i));
+  auto values = [](const auto& m) {
+    std::vector<std::pair<int, int>> out;
+    for (auto it = m.begin(); it != m.end(); ++it)
+      out.emplace_back((*it).first, (*it).second.value);
+    return out;
+  };
+  const auto a_before = values(a);
+  const auto b_before = values(b);
+  FlakyCopy::budget = 150;
+  EXPECT_THROW(a.merge(b), std::runtime_error);
+  FlakyCopy::budget = 1 << 30;
+  EXPECT_EQ(values(a), a_before);
+  EXPECT_EQ(values(b), b_before);
+  a.merge(b);
+  EXPECT_EQ(a.size(), 200u);
+  EXPECT_EQ(b.size(), 50u);
+  EXPECT_EQ(a.at(4).value, -4);
+  EXPECT_EQ(a.at(6).value, 6);
+
+  s21::btree_multiset<FlakyCopy> ms;
+  s21::btree_multiset<FlakyCopy> other;
+  for (int i = 0; i < 100; ++i) {
+    ms.insert(FlakyCopy(i));
+    other.insert(FlakyCopy(i));
+  }
+  FlakyCopy::budget = 150;
+  EXPECT_THROW(ms.merge(other), std::runtime_error);
+  FlakyCopy::budget = 1 << 30;
+  EXPECT_EQ(ms.size(), 100u);
+  EXPECT_EQ(other.size(), 100u);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(other.count(FlakyCopy(i)), 1u);
+  ms.merge(other);
+  EXPECT_EQ(ms.size(), 200u);
+  EXPECT_TRUE(other.empty());
+}
+
+TEST(BTree, MergeMovesSmallTreesIn) {
+  s21::btree_map<int, std::unique_ptr<int>> owners;
+  s21::btree_map<int, std::unique_ptr<int>> more;
+  for (int i = 0; i < 100; ++i) owners.emplace(i * 2, std::make_unique<int>(i));
+  more.emplace(3, std::make_unique<int>(-3));
+  more.emplace(4, std::make_unique<int>(-4));
+  owners.merge(more);
+  EXPECT_EQ(owners.size(), 101u);
+  EXPECT_EQ(*owners.at(3), -3);
+  ASSERT_EQ(more.size(), 1u);
+  EXPECT_EQ(*more.at(4), -4);
+
+  // Far smaller than the target: elements are moved, nothing is copied.
+  s21::btree_map<int, FlakyCopy> big;
+  s21::btree_map<int, FlakyCopy> small;
+  for (int i = 0; i < 1000; ++i) big.emplace(i * 2, FlakyCopy(i));
+  for (int i = 0; i < 10; ++i) small.emplace(i * 7, FlakyCopy(-i));
+  FlakyCopy::budget = 0;
+  big.merge(small);
+  FlakyCopy::budget = 1 << 30;
+  EXPECT_EQ(big.size(), 1005u);
+  EXPECT_EQ(small.size(), 5u);
+  EXPECT_EQ(big.at(7).value, -1);
+  EXPECT_EQ(small.at(14).value, -2);
+}
+
+TEST(BTree, ThrowingMoveMergeKeepsEveryElementOnce) {
+  using FlakyTree = s21::BTree<FlakyCopy, void, std::less<FlakyCopy>,
+                               std::allocator<FlakyCopy>, true, 64>;
+  FlakyTree big(std::less<FlakyCopy>{});
+  FlakyTree small(std::less<FlakyCopy>{});
+  std::multiset<int> all;
+  for (int i = 0; i < 400; ++i) {
+    big.insert_equal(FlakyCopy(i));
+    all.insert(i);
+  }
+  for (int i = 0; i < 40; ++i) {
+    small.insert_equal(FlakyCopy(i * 10 + 5));
+    all.insert(i * 10 + 5);
+  }
+  // Sorted loads leave every leaf full, so the first move splits a leaf
+  // and copies a separator.
+  FlakyCopy::budget = 0;
+  EXPECT_THROW(big.merge(small), std::runtime_error);
+  FlakyCopy::budget = 1 << 30;
+  EXPECT_TRUE(big.verify());
+  EXPECT_TRUE(small.verify());
+  std::multiset<int> seen;
+  for (auto it = big.begin(); it != big.end(); ++it) seen.insert(it->value);
+  for (auto it = small.begin(); it != small.end(); ++it)
+    seen.insert(it->value);
+  EXPECT_EQ(seen, all);
+  EXPECT_EQ(big.size() + small.size(), all.size());
+}
+
+TEST(BTree, SetAndMultisetInterface) {
+  s21::btree_set<int> s;
+  for (int i = 1000; i > 0; --i) s.insert(i % 500);
+  EXPECT_EQ(s.size(), 500u);
+  EXPECT_EQ(*s.begin(), 0);
+  EXPECT_EQ(*s.lower_bound(250), 250);
+  int expected = 499;
+  for (auto it = s.end(); it != s.begin();) EXPECT_EQ(*--it, expected--);
+  auto res = s.insert_many(7, 1000, 1001);
+  EXPECT_FALSE(res[0].second);
+  EXPECT_EQ(*res[0].first, 7);
+  EXPECT_EQ(*res[2].first, 1001);
+
+  s21::btree_multiset<std::string> ms{"b", "a", "b"};
+  auto many = ms.insert_many("b", "c", "b");
+  ASSERT_EQ(many.size(), 3u);
+  EXPECT_EQ(ms.count("b"), 4u);
+  EXPECT_EQ(std::distance(ms.begin(), many[0]), 3);
+  EXPECT_EQ(std::distance(ms.begin(), many[2]), 4);
+  auto [lo, hi] = ms.equal_range("b");
+  EXPECT_EQ(std::distance(lo, hi), 4);
+  EXPECT_EQ(ms.erase("b"), 4u);
+  EXPECT_EQ(std::vector<std::string>(ms.begin(), ms.end()),
+            (std::vector<std::string>{"a", "c"}));
+}
+
+TEST(BTree, CopyAndMoveOwnTheirNodes) {
+  s21::btree_map<std::string, std::vector<int>> m;
+  for (int i = 0; i < 3000; ++i)
+    m[std::to_string(i)] = std::vector<int>(static_cast<std::size_t>(i % 5),
+                                            i);
+  auto copy = m;
+  auto moved = std::move(m);
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.begin(), m.end());
+  copy.erase("42");
+  EXPECT_EQ(copy.size(), 2999u);
+  EXPECT_EQ(moved.size(), 3000u);
+  EXPECT_EQ(moved.at("42"), std::vector<int>(2, 42));
+  m = copy;
+  EXPECT_FALSE(m.contains("42"));
+  m.clear();
+  m.insert("x", {1});
+  EXPECT_EQ(m.size(), 1u);
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(ConcurrentMap, MatchesStdMapSingleThreaded) {
+  s21::concurrent_map<int, std::string> m;
+  std::map<int, std::string> ref;
+  std::mt19937 rng(9);
+  for (int step = 0; step < 30000; ++step) {
+    const int key = static_cast<int>(rng() % 2000);
+    switch (rng() % 4) {
+      case 0:
+      case 1: {
+        const bool inserted = ref.emplace(key, std::to_string(step)).second;
+        ASSERT_EQ(m.try_emplace(key, std::to_string(step)), inserted);
+        break;
+      }
+      case 2:
+        ASSERT_EQ(m.erase(key), ref.erase(key) == 1);
+        break;
+      default: {
+        auto it = m.lower_bound(key);
+        auto expected = ref.lower_bound(key);
+        if (expected == ref.end()) {
+          ASSERT_EQ(it, m.end());
+        } else {
+          ASSERT_NE(it, m.end());
+          ASSERT_EQ(it->first, expected->first);
+          ASSERT_EQ(it->second, expected->second);
+        }
+      }
+    }
+  }
+  EXPECT_EQ(m.size(), ref.size());
+  auto expected = ref.begin();
+  for (const auto& [key, value] : m) {
+    ASSERT_NE(expected, ref.end());
+    EXPECT_EQ(key, expected->first);
+    EXPECT_EQ(value, expected->second);
+    ++expected;
+  }
+  EXPECT_EQ(expected, ref.end());
+  EXPECT_TRUE(m.contains(ref.begin()->first));
+  EXPECT_EQ(m.find(-1), m.end());
+}
+
+TEST(ConcurrentMap, ReleasesErasedAndRemainingValues) {
+  auto tracked = std::make_shared<int>(1);
+  {
+    s21::concurrent_map<int, std::shared_ptr<int>> m;
+    for (int i = 0; i < 100; ++i) m.insert(i, tracked);
+    EXPECT_FALSE(m.insert(5, tracked));
+    EXPECT_EQ(tracked.use_count(), 101);
+    {
+      // An iterator keeps its element readable after the erase.
+      auto it = m.find(5);
+      EXPECT_TRUE(m.erase(5));
+      EXPECT_FALSE(m.erase(5));
+      EXPECT_EQ(*it->second, 1);
+      EXPECT_EQ((++it)->first, 6);
+    }
+    for (int i = 0; i < 3; ++i) s21::epoch_domain::global().collect();
+    EXPECT_EQ(tracked.use_count(), 100);
+    EXPECT_FALSE(m.contains(5));
+  }
+  EXPECT_EQ(tracked.use_count(), 1);
+}
+
+TEST(ConcurrentMap, ConcurrentChurnKeepsListSorted) {
+  constexpr int kThreads = 4;
+  constexpr int kKeys = 512;
+  s21::concurrent_map<int, int> m;
+  std::atomic<int> net{0};
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      std::mt19937 rng(t + 1);
+      int local = 0;
+      for (int i = 0; i < 40000; ++i) {
+        const int key = static_cast<int>(rng() % kKeys);
+        if (rng() & 1u) {
+          local += m.insert(key, key);
+        } else {
+          local -= m.erase(key);
+        }
+        if (auto it = m.find(key); it != m.end() && it->second != key)
+          local = -1000000;
+      }
+      net.fetch_add(local);
+    });
+  }
+  for (auto& th : threads) th.join();
+
+  int count = 0;
+  int prev = -1;
+  for (const auto& [key, value] : m) {
+    EXPECT_GT(key, prev);
+    EXPECT_EQ(value, key);
+    prev = key;
+    ++count;
+  }
+  EXPECT_EQ(count, net.load());
+  EXPECT_EQ(m.size(), static_cast<std::size_t>(count));
+}
+
+TEST(ConcurrentMap, IterationSeesEveryStableKey) {
+  // Even keys stay for the whole test; writers churn the odd ones.
+  constexpr int kKeys = 4000;
+  s21::concurrent_map<int, int> m;
+  for (int k = 0; k < kKeys; k += 2) m.insert(k, k);
+  std::atomic<bool> stop{false};
+
+  std::vector<std::thread> writers;
+  for (int t = 0; t < 2; ++t) {
+    writers.emplace_back([&, t] {
+      std::mt19937 rng(t + 7);
+      while (!stop.load(std::memory_order_relaxed)) {
+        const int key = static_cast<int>(rng() % (kKeys / 2)) * 2 + 1;
+        if (rng() & 1u)
+          m.insert(key, key);
+        else
+          m.erase(key);
+      }
+    });
+  }
+  for (int pass = 0; pass < 50; ++pass) {
+    int prev = -1;
+    int evens = 0;
+    for (auto it = m.begin(); it != m.end(); ++it) {
+      ASSERT_GT(it->first, prev);
+      prev = it->first;
+      evens += it->first % 2 == 0;
+    }
+    ASSERT_EQ(evens, kKeys / 2);
+    auto lb = m.lower_bound(kKeys / 2 + 1);
+    ASSERT_NE(lb, m.end());
+    ASSERT_GT(lb->first, kKeys / 2);
+  }
+  stop.store(true);
+  for (auto& th : writers) th.join();
+}
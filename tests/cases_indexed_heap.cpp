@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(IndexedHeap, PushPopMinFirst) {
+  s21::indexed_heap<int> h;
+  for (int v : {5, 1, 9, 3}) h.push(v);
+  EXPECT_EQ(h.size(), 4u);
+  std::vector<int> out;
+  while (!h.empty()) {
+    out.push_back(h.top());
+    h.pop();
+  }
+  EXPECT_EQ(out, (std::vector<int>{1, 3, 5, 9}));
+}
+
+TEST(IndexedHeap, CompareMeansWhatPriorityQueueMeans) {
+  s21::indexed_heap<int, std::less<int>> h;
+  s21::priority_queue<int, std::less<int>> pq;
+  for (int v : {5, 1, 9, 3}) {
+    h.push(v);
+    pq.push(v);
+  }
+  while (!pq.empty()) {
+    ASSERT_EQ(h.top(), pq.top());
+    h.pop();
+    pq.pop();
+  }
+  EXPECT_TRUE(h.empty());
+
+  // Under std::less, decrease_key still means "moves toward the top".
+  s21::indexed_heap<int, std::less<int>> max_heap;
+  max_heap.push(10);
+  const auto low = max_heap.push(1);
+  max_heap.decrease_key(low, 20);
+  EXPECT_EQ(max_heap.top_handle(), low);
+}
+
+TEST(IndexedHeap, HandlesTrackValues) {
+  s21::indexed_heap<int> h;
+  auto a = h.push(10);
+  auto b = h.push(20);
+  auto c = h.push(30);
+  EXPECT_EQ(h.value(b), 20);
+
+  h.decrease_key(c, 5);
+  EXPECT_EQ(h.top(), 5);
+  EXPECT_EQ(h.top_handle(), c);
+
+  h.increase_key(c, 40);
+  EXPECT_EQ(h.top_handle(), a);
+
+  h.update(b, 1);
+  EXPECT_EQ(h.top_handle(), b);
+  h.update(b, 100);
+  EXPECT_EQ(h.top_handle(), a);
+  EXPECT_EQ(h.value(c), 40);
+}
+
+TEST(IndexedHeap, EraseByHandleAndRecycle) {
+  s21::indexed_heap<int> h;
+  auto a = h.push(3);
+  auto b = h.push(1);
+  h.push(2);
+  h.erase(b);
+  EXPECT_FALSE(h.contains(b));
+  EXPECT_THROW(h.value(b), std::out_of_range);
+  EXPECT_THROW(h.erase(b), std::out_of_range);
+  EXPECT_EQ(h.top(), 2);
+
+  auto d = h.push(0);
+  EXPECT_EQ(d, b);
+  EXPECT_EQ(h.top_handle(), d);
+  EXPECT_TRUE(h.contains(a));
+}
+
+TEST(IndexedHeap, RandomizedAgainstReference) {
+  std::mt19937 rng(99);
+  s21::indexed_heap<int, std::greater<int>, 2> h;
+  std::vector<std::pair<std::size_t, int>> live;
+  for (int step = 0; step < 3000; ++step) {
+    const unsigned op = rng() % 4;
+    if (op == 0 || live.empty()) {
+      const int v = static_cast<int>(rng() % 1000);
+      live.push_back({h.push(v), v});
+    } else if (op == 1) {
+      const std::size_t k = rng() % live.size();
+      const int v = static_cast<int>(rng() % 1000);
+      h.update(live[k].first, v);
+      live[k].second = v;
+    } else if (op == 2) {
+      const std::size_t k = rng() % live.size();
+      h.erase(live[k].first);
+      live.erase(live.begin() + static_cast<long>(k));
+    } else {
+      auto it = std::min_element(
+          live.begin(), live.end(),
+          [](const auto& x, const auto& y) { return x.second < y.second; });
+      ASSERT_EQ(h.top(), it->second);
+      h.pop();
+      live.erase(std::find_if(live.begin(), live.end(), [&](const auto& e) {
+        return e.second == it->second && !h.contains(e.first);
+      }));
+    }
+    ASSERT_EQ(h.size(), live.size());
+  }
+}
+
+TEST(IndexedHeap, DijkstraSmallGraph) {
+  // 0 -> 1 (4), 0 -> 2 (1), 2 -> 1 (2), 1 -> 3 (1), 2 -> 3 (5)
+  const std::vector<std::vector<std::pair<int, int>>> adj{
+      {{1, 4}, {2, 1}}, {{3, 1}}, {{1, 2}, {3, 5}}, {}};
+  const int inf = 1 << 30;
+  std::vector<int> dist(4, inf);
+  std::vector<std::size_t> handle(4);
+  s21::indexed_heap<std::pair<int, int>> pq;
+  dist[0] = 0;
+  for (int v = 0; v < 4; ++v) handle[v] = pq.push({dist[v], v});
+  while (!pq.empty()) {
+    const auto [d, u] = pq.top();
+    pq.pop();
+    for (auto [v, w] : adj[u]) {
+      if (d + w < dist[v]) {
+        dist[v] = d + w;
+        pq.decrease_key(handle[v], {dist[v], v});
+      }
+    }
+  }
+  EXPECT_EQ(dist, (std::vector<int>{0, 3, 1, 4}));
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(LockfreeStack, PushPopLifo) {
+  s21::lockfree_stack<std::string> s;
+  EXPECT_TRUE(s.empty());
+  s.push("a");
+  s.push(std::string("b"));
+  s.emplace(3, 'c');
+
+  std::string v;
+  EXPECT_TRUE(s.try_pop(v));
+  EXPECT_EQ(v, "ccc");
+  EXPECT_TRUE(s.try_pop(v));
+  EXPECT_EQ(v, "b");
+  EXPECT_TRUE(s.try_pop(v));
+  EXPECT_EQ(v, "a");
+  EXPECT_FALSE(s.try_pop(v));
+  EXPECT_TRUE(s.empty());
+}
+
+TEST(LockfreeStack, PopAllReturnsPopOrder) {
+  s21::lockfree_stack<int> s;
+  for (int i = 0; i < 5; ++i) s.push(i);
+  auto items = s.pop_all();
+  ASSERT_EQ(items.size(), 5u);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(items[i], 4 - i);
+  EXPECT_TRUE(s.empty());
+  EXPECT_TRUE(s.pop_all().empty());
+}
+
+TEST(LockfreeStack, DestructorReleasesRemainingValues) {
+  auto tracked = std::make_shared<int>(7);
+  {
+    s21::lockfree_stack<std::shared_ptr<int>> s;
+    for (int i = 0; i < 10; ++i) s.push(tracked);
+    std::shared_ptr<int> out;
+    EXPECT_TRUE(s.try_pop(out));
+    EXPECT_EQ(tracked.use_count(), 11);
+  }
+  EXPECT_EQ(tracked.use_count(), 1);
+}
+
+TEST(LockfreeStack, ConcurrentPushPopKeepsEveryValue) {
+  constexpr int kThreads = 4;
+  constexpr int kPerThread = 20000;
+  s21::lockfree_stack<int> s;
+  std::atomic<long long> popped_sum{0};
+  std::atomic<int> popped{0};
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      int v = 0;
+      for (int i = 0; i < kPerThread; ++i) {
+        s.push(t * kPerThread + i);
+        if (i % 2 == 0 && s.try_pop(v)) {
+          popped_sum.fetch_add(v);
+          popped.fetch_add(1);
+        }
+      }
+    });
+  }
+  for (auto& th : threads) th.join();
+
+  auto rest = s.pop_all();
+  for (std::size_t i = 0; i < rest.size(); ++i) {
+    popped_sum.fetch_add(rest[i]);
+    popped.fetch_add(1);
+  }
+  const long long n = kThreads * kPerThread;
+  EXPECT_EQ(popped.load(), n);
+  EXPECT_EQ(popped_sum.load(), n * (n - 1) / 2);
+}
+
+struct CountedNode {
+  static inline std::atomic<int> alive{0};
+  CountedNode() { alive.fetch_add(1); }
+  ~CountedNode() { alive.fetch_sub(1); }
+};
+
+TEST(EpochDomain, RetiredObjectsAreFreedAfterCollect) {
+  auto& domain = s21::epoch_domain::global();
+  for (int i = 0; i < 10; ++i) domain.retire(new CountedNode);
+  EXPECT_EQ(CountedNode::alive.load(), 10);
+  for (int i = 0; i < 3; ++i) domain.collect();
+  EXPECT_EQ(CountedNode::alive.load(), 0);
+}
+
+TEST(EpochDomain, PinnedThreadDelaysReclamation) {
+  auto& domain = s21::epoch_domain::global();
+  std::atomic<bool> pinned{false}, release{false};
+  std::thread reader([&] {
+    s21::epoch_domain::guard g(domain);
+    pinned.store(true);
+    while (!release.load()) std::this_thread::yield();
+  });
+  while (!pinned.load()) std::this_thread::yield();
+
+  domain.retire(new CountedNode);
+  for (int i = 0; i < 3; ++i) domain.collect();
+  EXPECT_EQ(CountedNode::alive.load(), 1);
+
+  release.store(true);
+  reader.join();
+  for (int i = 0; i < 3; ++i) domain.collect();
+  EXPECT_EQ(CountedNode::alive.load(), 0);
+}
@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 #include "../s21_containers.h"
+#include "../s21_containersplus.h"
 
 // MAP
 
@@ -309,4 +315,104 @@ TEST(StackInsertMany, InsertMultipleElements) {
 
   s.pop();
   EXPECT_EQ(s.top(), 2);
-}
\ No newline at end of file
+}
+TEST(MultisetErase, RandomEraseKeepsTreeConsistent) {
+  s21::multiset<int> ms;
+  std::multiset<int> ref;
+  unsigned seed = 17;
+  for (int step = 0; step < 5000; ++step) {
+    seed = seed * 1103515245u + 12345u;
+    const int key = static_cast<int>((seed >> 8) % 200);
+    if (seed % 3 == 0 && !ref.empty()) {
+      auto it = ms.find(key);
+      auto rit = ref.find(key);
+      ASSERT_EQ(it == ms.end(), rit == ref.end());
+      if (rit != ref.end()) {
+        ms.erase(it);
+        ref.erase(rit);
+      }
+    } else {
+      ms.insert(key);
+      ref.insert(key);
+    }
+  }
+  ASSERT_EQ(ms.size(), ref.size());
+  auto rit = ref.begin();
+  for (auto it = ms.begin(); it != ms.end(); ++it, ++rit)
+    EXPECT_EQ(*it, *rit);
+}
+
+TEST(MultisetIterate, DuplicateOfMaximumIsLast) {
+  s21::multiset<int> ms{2, 2};
+  std::vector<int> got;
+  for (auto it = ms.begin(); it != ms.end(); ++it) got.push_back(*it);
+  EXPECT_EQ(got, (std::vector<int>{2, 2}));
+  EXPECT_EQ(ms.count(2), 2u);
+}
+
+namespace {
+
+struct CopyCounted {
+  static inline int copies = 0;
+  int v;
+  explicit CopyCounted(int x = 0) : v(x) {}
+  CopyCounted(const CopyCounted& o) : v(o.v) { ++copies; }
+  CopyCounted& operator=(const CopyCounted& o) {
+    v = o.v;
+    ++copies;
+    return *this;
+  }
+  bool operator<(const CopyCounted& o) const { return v < o.v; }
+};
+
+}  // namespace
+
+TEST(SetLayout, IteratorsAreConstant) {
+  using S = s21::set<int>;
+  using MS = s21::multiset<int>;
+  static_assert(std::is_same_v<decltype(*S::iterator()), const int&>);
+  static_assert(std::is_same_v<decltype(*S::const_iterator()), const int&>);
+  static_assert(std::is_same_v<decltype(*MS::iterator()), const int&>);
+  static_assert(!std::is_assignable_v<decltype(*S::iterator()), int>);
+  using M = s21::map<int, int>;
+  static_assert(std::is_same_v<decltype(*M::iterator()),
+                               std::pair<const int, int>&>);
+}
+
+TEST(SetLayout, InsertCopiesKeyOnce) {
+  s21::set<CopyCounted> s;
+  s21::multiset<CopyCounted> ms;
+  const CopyCounted key(3);
+  CopyCounted::copies = 0;
+  s.insert(key);
+  EXPECT_EQ(CopyCounted::copies, 1);
+  ms.insert(key);
+  ms.insert(key);
+  EXPECT_EQ(CopyCounted::copies, 3);
+  EXPECT_EQ(s.begin()->v, 3);
+  EXPECT_EQ(ms.count(key), 2u);
+}
+
+TEST(SetLayout, StringSetIteratesKeys) {
+  s21::set<std::string> s{"pear", "apple", "fig"};
+  std::vector<std::string> got(s.begin(), s.end());
+  EXPECT_EQ(got, (std::vector<std::string>{"apple", "fig", "pear"}));
+  EXPECT_EQ(*s.find("fig"), "fig");
+}
+
+TEST(RedBlackNode, ColorSharesParentWord) {
+  using N = s21::Node<std::pair<const int, int>>;
+  static_assert(sizeof(N) == 3 * sizeof(void*) + sizeof(std::pair<int, int>));
+  N parent;
+  N child;
+  EXPECT_EQ(child.color(), s21::Color::RED);
+  child.set_color(s21::Color::BLACK);
+  child.set_parent(&parent);
+  EXPECT_EQ(child.parent(), &parent);
+  EXPECT_EQ(child.color(), s21::Color::BLACK);
+  child.set_color(s21::Color::RED);
+  EXPECT_EQ(child.parent(), &parent);
+  child.set_parent(nullptr);
+  EXPECT_EQ(child.parent(), nullptr);
+  EXPECT_EQ(child.color(), s21::Color::RED);
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <type_traits>
+
+#include "../s21_containersplus.h"
+
+TEST(Mdview, RowMajorOverVector) {
+  s21::vector<int> data(12);
+  s21::mdview<int, s21::dextents<2>> m(data, 3, 4);
+  EXPECT_EQ(m.rank(), 2u);
+  EXPECT_EQ(m.extent(0), 3u);
+  EXPECT_EQ(m.extent(1), 4u);
+  EXPECT_EQ(m.size(), 12u);
+  EXPECT_EQ(m.stride(0), 4u);
+  EXPECT_EQ(m.stride(1), 1u);
+
+  for (std::size_t i = 0; i < 3; ++i)
+    for (std::size_t j = 0; j < 4; ++j) m(i, j) = static_cast<int>(i * 10 + j);
+  EXPECT_EQ(data[1 * 4 + 2], 12);
+  EXPECT_EQ(data[11], 23);
+}
+
+TEST(Mdview, ColumnMajorAndThreeDimensions) {
+  s21::array<int, 24> data{};
+  s21::mdview<int, s21::extents<2, 3, 4>, s21::layout_left> m(data);
+  m(1, 2, 3) = 7;
+  EXPECT_EQ(data[1 + 2 * 2 + 3 * 2 * 3], 7);
+  EXPECT_EQ(m.stride(2), 6u);
+
+  s21::mdview<int, s21::extents<2, 3, 4>> r(data);
+  r(1, 2, 3) = 9;
+  EXPECT_EQ(data[1 * 12 + 2 * 4 + 3], 9);
+}
+
+TEST(Mdview, StaticExtentsAreConstant) {
+  using E = s21::extents<s21::dynamic_extent, 8>;
+  static_assert(E::rank() == 2 && E::rank_dynamic() == 1);
+  static_assert(E::static_extent(1) == 8);
+  static_assert(sizeof(E) == sizeof(std::size_t));
+  static_assert(sizeof(s21::extents<4, 4>) == 1);
+
+  constexpr int folded = [] {
+    s21::array<int, 16> buf{};
+    s21::mdview<int, s21::extents<4, 4>> m(buf.data());
+    for (std::size_t i = 0; i < 4; ++i) m(i, i) = 1;
+    int trace = 0;
+    for (int v : buf) trace += v;
+    return trace;
+  }();
+  static_assert(folded == 4);
+  EXPECT_EQ(folded, 4);
+}
+
+TEST(Mdview, StridedSubmatrixAndTranspose) {
+  s21::vector<int> data(20);
+  for (std::size_t k = 0; k < data.size(); ++k) data[k] = static_cast<int>(k);
+  using Strided = s21::mdview<int, s21::dextents<2>, s21::layout_stride>;
+  using Map = Strided::mapping_type;
+
+  // Rows 1..2, every other column of a 4x5 row-major matrix.
+  Strided sub(data.data() + 5, Map(s21::dextents<2>(2, 3), {{5, 2}}));
+  EXPECT_EQ(sub(0, 0), 5);
+  EXPECT_EQ(sub(0, 2), 9);
+  EXPECT_EQ(sub(1, 1), 12);
+  EXPECT_EQ(sub.mapping().required_span_size(), 10u);
+
+  Strided t(data, Map(s21::dextents<2>(5, 4), {{1, 5}}));
+  EXPECT_EQ(t(3, 2), data[2 * 5 + 3]);
+}
+
+TEST(Mdview, TiledLayoutIsABijectionWithPadding) {
+  using View = s21::mdview<int, s21::dextents<2>, s21::layout_tiled<4, 2>>;
+  const View::mapping_type map(s21::dextents<2>(6, 5));
+  const std::size_t span = map.required_span_size();
+  EXPECT_EQ(span, 2u * 3u * 8u);
+
+  s21::vector<int> hits(span);
+  for (std::size_t i = 0; i < 6; ++i)
+    for (std::size_t j = 0; j < 5; ++j) ++hits[map(i, j)];
+  std::size_t used = 0;
+  for (int h : hits) {
+    EXPECT_LE(h, 1);
+    used += static_cast<std::size_t>(h);
+  }
+  EXPECT_EQ(used, 30u);
+  // Elements of one tile are contiguous.
+  EXPECT_EQ(map(0, 1), 1u);
+  EXPECT_EQ(map(1, 0), 2u);
+  EXPECT_EQ(map(0, 2), 8u);
+}
+
+TEST(Mdview, BoundsAndSpanChecks) {
+  s21::vector<double> small(5);
+  EXPECT_THROW((s21::mdview<double, s21::dextents<2>>(small, 2, 3)),
+               std::length_error);
+  s21::vector<double> data(6);
+  s21::mdview<const double, s21::dextents<2>> m(data, 2, 3);
+  static_assert(std::is_same_v<decltype(m(0, 0)), const double&>);
+  EXPECT_NO_THROW(m.at(1, 2));
+  EXPECT_THROW(m.at(2, 0), std::out_of_range);
+  EXPECT_THROW(m.at(0, 3), std::out_of_range);
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(MinMaxHeap, MinAndMaxAfterPushes) {
+  s21::minmax_heap<int> h;
+  h.push(5);
+  EXPECT_EQ(h.min(), 5);
+  EXPECT_EQ(h.max(), 5);
+  for (int v : {3, 9, 1, 7}) h.push(v);
+  EXPECT_EQ(h.size(), 5u);
+  EXPECT_EQ(h.min(), 1);
+  EXPECT_EQ(h.max(), 9);
+}
+
+TEST(MinMaxHeap, PopBothEnds) {
+  s21::minmax_heap<int> h{4, 8, 1, 6, 3, 9, 2};
+  h.pop_max();
+  EXPECT_EQ(h.max(), 8);
+  h.pop_min();
+  EXPECT_EQ(h.min(), 2);
+  h.pop_max();
+  h.pop_min();
+  EXPECT_EQ(h.min(), 3);
+  EXPECT_EQ(h.max(), 6);
+  EXPECT_EQ(h.size(), 3u);
+}
+
+TEST(MinMaxHeap, HeapifyFromRange) {
+  std::vector<int> src{10, 50, 20, 40, 30, 60, 70, 0};
+  s21::minmax_heap<int> h(src.begin(), src.end());
+  std::vector<int> ascending;
+  while (!h.empty()) {
+    ascending.push_back(h.min());
+    h.pop_min();
+  }
+  EXPECT_EQ(ascending, (std::vector<int>{0, 10, 20, 30, 40, 50, 60, 70}));
+}
+
+TEST(MinMaxHeap, CustomCompareReversesEnds) {
+  s21::minmax_heap<std::string, std::greater<std::string>> h;
+  h.emplace("b");
+  h.push(std::string("a"));
+  h.emplace(1, 'c');
+  EXPECT_EQ(h.min(), "c");
+  EXPECT_EQ(h.max(), "a");
+}
+
+TEST(MinMaxHeap, RandomizedAgainstMultiset) {
+  std::mt19937 rng(5);
+  std::vector<int> seed(300);
+  for (auto& v : seed) v = static_cast<int>(rng() % 1000);
+  s21::minmax_heap<int> h(seed.begin(), seed.end());
+  std::multiset<int> ref(seed.begin(), seed.end());
+  for (int step = 0; step < 5000; ++step) {
+    const unsigned op = rng() % 3;
+    if (op == 0 || ref.empty()) {
+      const int v = static_cast<int>(rng() % 1000);
+      h.push(v);
+      ref.insert(v);
+    } else if (op == 1) {
+      h.pop_min();
+      ref.erase(ref.begin());
+    } else {
+      h.pop_max();
+      ref.erase(std::prev(ref.end()));
+    }
+    ASSERT_EQ(h.size(), ref.size());
+    if (!ref.empty()) {
+      ASSERT_EQ(h.min(), *ref.begin());
+      ASSERT_EQ(h.max(), *ref.rbegin());
+    }
+  }
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(MpmcQueue, SingleThreadFifo) {
+  s21::mpmc_queue<int> q(4);
+  EXPECT_EQ(q.capacity(), 4u);
+  for (int i = 0; i < 4; ++i) EXPECT_TRUE(q.try_push(i));
+  EXPECT_FALSE(q.try_push(4));
+
+  int v = -1;
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(q.try_pop(v));
+    EXPECT_EQ(v, i);
+  }
+  EXPECT_FALSE(q.try_pop(v));
+  EXPECT_THROW(s21::mpmc_queue<int>(1), std::invalid_argument);
+}
+
+TEST(MpmcQueue, WrapsManyLaps) {
+  s21::mpmc_queue<std::string> q(2);
+  std::string out;
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(q.try_emplace(3, static_cast<char>('a' + i % 26)));
+    EXPECT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out, std::string(3, static_cast<char>('a' + i % 26)));
+  }
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(MpmcQueue, DestroysRemainingElements) {
+  auto tracker = std::make_shared<int>(1);
+  {
+    s21::mpmc_queue<std::shared_ptr<int>> q(8);
+    q.push(tracker);
+    q.emplace(tracker);
+    EXPECT_EQ(q.size_approx(), 2u);
+  }
+  EXPECT_EQ(tracker.use_count(), 1);
+}
+
+TEST(MpmcQueue, ManyProducersManyConsumers) {
+  constexpr int kProducers = 4;
+  constexpr int kConsumers = 4;
+  constexpr int kPerProducer = 20000;
+  s21::mpmc_queue<int> q(128);
+  std::atomic<long long> sum{0};
+  std::atomic<int> consumed{0};
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&, p] {
+      for (int i = 0; i < kPerProducer; ++i) q.push(p * kPerProducer + i);
+    });
+  }
+  for (int c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&] {
+      int v = 0;
+      while (consumed.load() < kProducers * kPerProducer) {
+        if (q.try_pop(v)) {
+          sum += v;
+          ++consumed;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto& t : threads) t.join();
+
+  const long long n = static_cast<long long>(kProducers) * kPerProducer;
+  EXPECT_EQ(consumed.load(), n);
+  EXPECT_EQ(sum.load(), n * (n - 1) / 2);
+}
+
+TEST(MpmcQueue, BlockingPopWaitsForProducer) {
+  s21::mpmc_queue<int> q(2);
+  std::thread producer([&] {
+    for (int i = 0; i < 1000; ++i) q.push(i);
+  });
+  int v = 0;
+  for (int i = 0; i < 1000; ++i) {
+    q.pop(v);
+    EXPECT_EQ(v, i);
+  }
+  producer.join();
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+
+template <class PQ>
+std::vector<int> drain(PQ& pq) {
+  std::vector<int> out;
+  while (!pq.empty()) {
+    out.push_back(pq.top());
+    pq.pop();
+  }
+  return out;
+}
+
+}  // namespace
+
+TEST(PriorityQueue, PushPopMaxFirst) {
+  s21::priority_queue<int> pq;
+  for (int v : {5, 1, 9, 3, 7}) pq.push(v);
+  EXPECT_EQ(pq.size(), 5u);
+  EXPECT_EQ(pq.top(), 9);
+  EXPECT_EQ(drain(pq), (std::vector<int>{9, 7, 5, 3, 1}));
+  pq.pop();
+  EXPECT_TRUE(pq.empty());
+}
+
+TEST(PriorityQueue, CustomCompareMinHeap) {
+  s21::priority_queue<int, std::greater<int>> pq{4, 2, 8, 6};
+  EXPECT_EQ(pq.top(), 2);
+  EXPECT_EQ(drain(pq), (std::vector<int>{2, 4, 6, 8}));
+}
+
+TEST(PriorityQueue, RangeConstructionMatchesSort) {
+  std::mt19937 rng(42);
+  std::vector<int> src(1000);
+  for (auto& v : src) v = static_cast<int>(rng() % 500);
+
+  s21::priority_queue<int> binary(src.begin(), src.end());
+  s21::priority_queue<int, std::less<int>, s21::vector<int>, 4> quad(
+      src.begin(), src.end());
+
+  std::sort(src.begin(), src.end(), std::greater<int>());
+  EXPECT_EQ(drain(binary), src);
+  EXPECT_EQ(drain(quad), src);
+}
+
+TEST(PriorityQueue, InterleavedOperationsFourAry) {
+  std::mt19937 rng(7);
+  s21::priority_queue<int, std::less<int>, s21::vector<int>, 4> pq;
+  std::vector<int> reference;
+  for (int i = 0; i < 2000; ++i) {
+    if (rng() % 3 == 0 && !reference.empty()) {
+      auto it = std::max_element(reference.begin(), reference.end());
+      ASSERT_EQ(pq.top(), *it);
+      reference.erase(it);
+      pq.pop();
+    } else {
+      const int v = static_cast<int>(rng() % 1000);
+      reference.push_back(v);
+      pq.push(v);
+    }
+  }
+  EXPECT_EQ(pq.size(), reference.size());
+}
+
+TEST(PriorityQueue, PopPushReplacesTop) {
+  s21::priority_queue<int> pq{10, 20, 30};
+  pq.pop_push(5);
+  EXPECT_EQ(pq.size(), 3u);
+  EXPECT_EQ(drain(pq), (std::vector<int>{20, 10, 5}));
+
+  pq.pop_push(1);
+  EXPECT_EQ(pq.top(), 1);
+}
+
+TEST(PriorityQueue, EmplaceAndMoveOnlyContainerOps) {
+  s21::priority_queue<std::string> pq;
+  pq.emplace(3, 'b');
+  pq.push(std::string("a"));
+  pq.emplace("c");
+  EXPECT_EQ(pq.top(), "c");
+  pq.pop();
+  EXPECT_EQ(pq.top(), "bbb");
+
+  s21::priority_queue<std::string> other;
+  other.swap(pq);
+  EXPECT_TRUE(pq.empty());
+  EXPECT_EQ(other.size(), 2u);
+}
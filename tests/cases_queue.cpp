@@ -0,0 +1,291 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+TEST(RingBuffer, PushPopWrapsAround) {
+  s21::ring_buffer<int> rb;
+  rb.reserve(4);
+  const auto cap = rb.capacity();
+  for (int round = 0; round < 10; ++round) {
+    rb.push_back(round);
+    rb.push_back(round + 100);
+    EXPECT_EQ(rb.front(), round);
+    rb.pop_front();
+    EXPECT_EQ(rb.front(), round + 100);
+    rb.pop_front();
+  }
+  EXPECT_TRUE(rb.empty());
+  EXPECT_EQ(rb.capacity(), cap);
+}
+
+TEST(RingBuffer, CapacityIsPowerOfTwo) {
+  s21::ring_buffer<int> rb;
+  rb.reserve(5);
+  EXPECT_EQ(rb.capacity(), 8u);
+  for (int i = 0; i < 9; ++i) rb.push_back(i);
+  EXPECT_EQ(rb.capacity(), 16u);
+  for (int i = 0; i < 9; ++i) EXPECT_EQ(rb[i], i);
+}
+
+TEST(RingBuffer, GrowthKeepsOrderAfterWrap) {
+  s21::ring_buffer<std::string> rb;
+  rb.reserve(8);
+  for (int i = 0; i < 6; ++i) rb.push_back(std::to_string(i));
+  for (int i = 0; i < 5; ++i) rb.pop_front();
+  for (int i = 6; i < 20; ++i) rb.push_back(std::to_string(i));
+  ASSERT_EQ(rb.size(), 15u);
+  for (int i = 0; i < 15; ++i) EXPECT_EQ(rb.at(i), std::to_string(i + 5));
+  EXPECT_THROW(rb.at(15), std::out_of_range);
+}
+
+TEST(RingBuffer, PushFrontAndPopBack) {
+  s21::ring_buffer<int> rb{2, 3};
+  rb.push_front(1);
+  rb.push_front(0);
+  EXPECT_EQ(rb.size(), 4u);
+  EXPECT_EQ(rb.front(), 0);
+  EXPECT_EQ(rb.back(), 3);
+  rb.pop_back();
+  EXPECT_EQ(rb.back(), 2);
+}
+
+TEST(RingBuffer, PushBackOwnElementWhileGrowing) {
+  s21::ring_buffer<std::string> rb;
+  rb.push_back("abc");
+  while (rb.size() < rb.capacity()) rb.push_back("x");
+  rb.push_back(rb.front());
+  EXPECT_EQ(rb.back(), "abc");
+}
+
+namespace {
+
+// Counts live objects; the second move-assignment since reset throws.
+struct Fragile {
+  static inline int live = 0;
+  static inline int assigns = 0;
+  Fragile() { ++live; }
+  Fragile(const Fragile&) { ++live; }
+  ~Fragile() { --live; }
+  Fragile& operator=(Fragile&&) {
+    if (++assigns == 2) throw std::runtime_error("assign");
+    return *this;
+  }
+};
+
+}  // namespace
+
+TEST(RingBuffer, ThrowingPopNKeepsUntakenElements) {
+  {
+    s21::ring_buffer<Fragile> rb;
+    for (int i = 0; i < 4; ++i) rb.push_back(Fragile());
+    Fragile out[4];
+    Fragile::assigns = 0;
+    EXPECT_THROW(rb.pop_front_n(out, 4), std::runtime_error);
+    EXPECT_EQ(rb.size(), 3u);
+    EXPECT_EQ(Fragile::live, 7);
+  }
+  EXPECT_EQ(Fragile::live, 0);
+}
+
+TEST(RingBuffer, CopyAndMove) {
+  s21::ring_buffer<int> a{1, 2, 3};
+  a.pop_front();
+  s21::ring_buffer<int> b(a);
+  ASSERT_EQ(b.size(), 2u);
+  EXPECT_EQ(b[0], 2);
+  s21::ring_buffer<int> c(std::move(a));
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(c.back(), 3);
+}
+
+TEST(QueueRing, PushRangeAndPopN) {
+  s21::queue<int> q;
+  int src[] = {1, 2, 3, 4, 5, 6, 7};
+  q.push_range(std::begin(src), std::end(src));
+  EXPECT_EQ(q.size(), 7u);
+
+  int out[4] = {};
+  EXPECT_EQ(q.pop_n(out, 4), 4u);
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(out[i], i + 1);
+  EXPECT_EQ(q.front(), 5);
+
+  EXPECT_EQ(q.pop_n(out, 4), 3u);
+  EXPECT_EQ(out[2], 7);
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(QueueRing, PopNAcrossWrapBoundary) {
+  s21::queue<int> q;
+  q.reserve(8);
+  for (int i = 0; i < 6; ++i) q.push(i);
+  for (int i = 0; i < 6; ++i) q.pop();
+  for (int i = 0; i < 8; ++i) q.push(i);
+  EXPECT_EQ(q.capacity(), 8u);
+
+  int out[8] = {};
+  EXPECT_EQ(q.pop_n(out, 8), 8u);
+  for (int i = 0; i < 8; ++i) EXPECT_EQ(out[i], i);
+}
+
+TEST(QueueRing, PopNMovesNonTrivial) {
+  s21::queue<std::string> q{"a", "b", "c"};
+  std::string out[2];
+  EXPECT_EQ(q.pop_n(out, 2), 2u);
+  EXPECT_EQ(out[0], "a");
+  EXPECT_EQ(out[1], "b");
+  EXPECT_EQ(q.front(), "c");
+}
+
+TEST(QueueAdapter, OverList) {
+  s21::queue<int, s21::list<int>> q{1, 2};
+  q.push(3);
+  q.emplace(4);
+  EXPECT_EQ(q.size(), 4u);
+  EXPECT_EQ(q.front(), 1);
+  EXPECT_EQ(q.back(), 4);
+
+  int src[] = {5, 6};
+  q.push_range(std::begin(src), std::end(src));
+  int out[3] = {};
+  EXPECT_EQ(q.pop_n(out, 3), 3u);
+  EXPECT_EQ(out[2], 3);
+  EXPECT_EQ(q.front(), 4);
+}
+
+TEST(QueueAdapter, EmplaceAndMovePush) {
+  s21::queue<std::string> q;
+  std::string s = "moved";
+  q.push(std::move(s));
+  auto& ref = q.emplace(3, 'z');
+  EXPECT_EQ(ref, "zzz");
+  EXPECT_EQ(q.front(), "moved");
+  q.front() = "changed";
+  EXPECT_EQ(q.front(), "changed");
+}
+
+TEST(StackAdapter, DefaultIsContiguous) {
+  s21::stack<int> s{1, 2, 3};
+  static_assert(
+      std::is_same_v<s21::stack<int>::container_type, s21::vector<int>>);
+  s.emplace(4);
+  s.push(5);
+  EXPECT_EQ(s.size(), 5u);
+  EXPECT_EQ(s.top(), 5);
+  s.top() = 50;
+  s.pop();
+  EXPECT_EQ(s.top(), 4);
+}
+
+TEST(StackAdapter, PopReleasesElement) {
+  auto tracked = std::make_shared<int>(1);
+  s21::stack<std::shared_ptr<int>> s;
+  s.push(tracked);
+  s.push(tracked);
+  EXPECT_EQ(tracked.use_count(), 3);
+  s.pop();
+  EXPECT_EQ(tracked.use_count(), 2);
+  s21::stack<std::shared_ptr<int>> empty;
+  s.swap(empty);
+  empty.pop();
+  EXPECT_EQ(tracked.use_count(), 1);
+}
+
+TEST(StackAdapter, OverListAndRingBuffer) {
+  s21::stack<std::string, s21::list<std::string>> ls;
+  ls.emplace("a");
+  ls.push(std::string("b"));
+  ls.insert_many_back("c", "d");
+  EXPECT_EQ(ls.top(), "d");
+  EXPECT_EQ(ls.size(), 4u);
+
+  s21::stack<int, s21::ring_buffer<int>> rs;
+  for (int i = 0; i < 100; ++i) rs.push(i);
+  for (int i = 99; i >= 50; --i) {
+    EXPECT_EQ(rs.top(), i);
+    rs.pop();
+  }
+  EXPECT_EQ(rs.size(), 50u);
+}
+
+TEST(StackAdapter, DepthFirstTraversal) {
+  // Implicit binary tree over indices 1..31.
+  s21::stack<int> frontier;
+  frontier.push(1);
+  int visited = 0;
+  while (!frontier.empty()) {
+    const int node = frontier.top();
+    frontier.pop();
+    ++visited;
+    if (2 * node + 1 <= 31) frontier.push(2 * node + 1);
+    if (2 * node <= 31) frontier.push(2 * node);
+  }
+  EXPECT_EQ(visited, 31);
+}
+
+TEST(StackCheckpoint, RollbackTruncatesToMark) {
+  s21::stack<int> trail;
+  trail.push(1);
+  trail.push(2);
+  const auto level1 = trail.mark();
+  for (int i = 0; i < 1000; ++i) trail.push(i);
+  const auto level2 = trail.mark();
+  trail.push(-1);
+
+  trail.rollback_to(level2);
+  EXPECT_EQ(trail.size(), 1002u);
+  EXPECT_EQ(trail.top(), 999);
+  trail.rollback_to(level1);
+  EXPECT_EQ(trail.size(), 2u);
+  EXPECT_EQ(trail.top(), 2);
+  trail.rollback_to(level2);  // deeper than current: no-op
+  EXPECT_EQ(trail.size(), 2u);
+  trail.push(3);
+  EXPECT_EQ(trail.top(), 3);
+}
+
+TEST(StackCheckpoint, UndoCallbackSeesEntriesNewestFirst) {
+  int assignment[4] = {0, 0, 0, 0};
+  struct Entry {
+    int var;
+    int old_value;
+  };
+  s21::stack<Entry> trail;
+  auto assign = [&](int var, int value) {
+    trail.push(Entry{var, assignment[var]});
+    assignment[var] = value;
+  };
+
+  assign(0, 5);
+  const auto choice = trail.mark();
+  assign(1, 7);
+  assign(0, 9);
+  assign(2, 1);
+
+  std::string order;
+  trail.rollback_to(choice, [&](const Entry& e) {
+    order += static_cast<char>('0' + e.var);
+    assignment[e.var] = e.old_value;
+  });
+  EXPECT_EQ(order, "201");
+  EXPECT_EQ(assignment[0], 5);
+  EXPECT_EQ(assignment[1], 0);
+  EXPECT_EQ(assignment[2], 0);
+  EXPECT_EQ(trail.size(), 1u);
+}
+
+TEST(StackCheckpoint, NonTrivialAndListBacked) {
+  s21::stack<std::string, s21::list<std::string>> s;
+  s.push("keep");
+  const auto m = s.mark();
+  s.push("drop1");
+  s.push("drop2");
+  s.rollback_to(m);
+  EXPECT_EQ(s.size(), 1u);
+  EXPECT_EQ(s.top(), "keep");
+}
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+
+struct AllocStats {
+  std::size_t calls = 0;
+  std::ptrdiff_t live_bytes = 0;
+};
+
+// Forwards to std::allocator and records traffic in a shared counter.
+template <class T>
+struct CountingAllocator {
+  using value_type = T;
+
+  AllocStats* stats;
+
+  explicit CountingAllocator(AllocStats* s) noexcept : stats(s) {}
+  template <class U>
+  CountingAllocator(const CountingAllocator<U>& other) noexcept
+      : stats(other.stats) {}
+
+  T* allocate(std::size_t n) {
+    ++stats->calls;
+    stats->live_bytes += static_cast<std::ptrdiff_t>(n * sizeof(T));
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, std::size_t n) noexcept {
+    stats->live_bytes -= static_cast<std::ptrdiff_t>(n * sizeof(T));
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <class U>
+  bool operator==(const CountingAllocator<U>& other) const noexcept {
+    return stats == other.stats;
+  }
+};
+
+}  // namespace
+
+TEST(SlabPool, RecyclesFreedSlots) {
+  s21::slab_pool<long> pool;
+  long* a = pool.allocate();
+  long* b = pool.allocate();
+  EXPECT_NE(a, b);
+  pool.deallocate(a);
+  EXPECT_EQ(pool.allocate(), a);
+  pool.deallocate(b);
+}
+
+TEST(SlabPool, ChunksGrowGeometricallyAndReleaseAll) {
+  AllocStats stats;
+  {
+    s21::slab_pool<long, CountingAllocator<long>> pool{
+        CountingAllocator<long>(&stats)};
+    for (int i = 0; i < 1000; ++i) (void)pool.allocate();
+    // 16 + 32 + ... + 512 = 1008 slots: six chunks, two calls each.
+    EXPECT_EQ(stats.calls, 12u);
+    pool.release();
+    EXPECT_EQ(stats.live_bytes, 0);
+    (void)pool.allocate();
+    EXPECT_GT(stats.live_bytes, 0);
+  }
+  EXPECT_EQ(stats.live_bytes, 0);
+}
+
+TEST(SlabPool, TreeAllocatesInChunks) {
+  AllocStats stats;
+  using Alloc = CountingAllocator<std::pair<const int, int>>;
+  s21::map<int, int, std::less<int>, Alloc> m{Alloc(&stats)};
+  for (int i = 0; i < 10000; ++i) m.insert(i, i);
+  EXPECT_LT(stats.calls, 40u);
+
+  const std::size_t before = stats.calls;
+  for (int i = 0; i < 10000; i += 2) m.erase(m.find(i));
+  for (int i = 0; i < 10000; i += 2) m.insert(i, -i);
+  EXPECT_EQ(stats.calls, before);
+  EXPECT_EQ(m.size(), 10000u);
+  EXPECT_EQ(m.at(42), -42);
+}
+
+TEST(SlabPool, ClearReturnsChunks) {
+  AllocStats stats;
+  using Alloc = CountingAllocator<int>;
+  {
+    s21::set<int, std::less<int>, Alloc> s{Alloc(&stats)};
+    const std::ptrdiff_t empty_bytes = stats.live_bytes;
+    for (int i = 0; i < 5000; ++i) s.insert(i);
+    EXPECT_GT(stats.live_bytes, empty_bytes);
+    s.clear();
+    EXPECT_EQ(stats.live_bytes, empty_bytes);
+    s.insert(7);
+    EXPECT_TRUE(s.contains(7));
+  }
+  EXPECT_EQ(stats.live_bytes, 0);
+}
+
+TEST(SlabPool, NonTrivialValuesAreDestroyed) {
+  auto token = std::make_shared<int>(0);
+  {
+    s21::map<int, std::shared_ptr<int>> m;
+    for (int i = 0; i < 100; ++i) m.insert(i, token);
+    m.erase(m.find(5));
+    EXPECT_EQ(token.use_count(), 100);
+    s21::map<int, std::shared_ptr<int>> copy(m);
+    EXPECT_EQ(token.use_count(), 199);
+    copy.clear();
+    EXPECT_EQ(token.use_count(), 100);
+  }
+  EXPECT_EQ(token.use_count(), 1);
+}
+
+TEST(SlabPool, MoveAndSwapKeepNodesWithTheirTree) {
+  s21::multiset<std::string> a{"x", "y", "y"};
+  s21::multiset<std::string> b{"z"};
+  a.swap(b);
+  s21::multiset<std::string> c(std::move(b));
+  EXPECT_EQ(a.size(), 1u);
+  EXPECT_EQ(c.count("y"), 2u);
+  c.insert("w");
+  a = std::move(c);
+  EXPECT_EQ(a.size(), 4u);
+  EXPECT_EQ(*a.begin(), "w");
+}
+
+TEST(SlabPool, ChurnMatchesStdMap) {
+  s21::map<int, int> m;
+  std::map<int, int> ref;
+  std::mt19937 rng(7);
+  for (int step = 0; step < 20000; ++step) {
+    const int key = static_cast<int>(rng() % 512);
+    if (rng() % 3 == 0) {
+      auto it = m.find(key);
+      ASSERT_EQ(it == m.end(), ref.count(key) == 0);
+      if (it != m.end()) m.erase(it);
+      ref.erase(key);
+    } else {
+      m.insert(key, step);
+      ref.emplace(key, step);
+    }
+  }
+  ASSERT_EQ(m.size(), ref.size());
+  auto rit = ref.begin();
+  for (auto it = m.begin(); it != m.end(); ++it, ++rit) {
+    EXPECT_EQ((*it).first, rit->first);
+    EXPECT_EQ((*it).second, rit->second);
+  }
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "../s21_containersplus.h"
+
+TEST(SpscQueue, CapacityRoundsUpToPowerOfTwo) {
+  s21::spsc_queue<int> q(5);
+  EXPECT_EQ(q.capacity(), 8u);
+  EXPECT_THROW(s21::spsc_queue<int>(0), std::invalid_argument);
+}
+
+TEST(SpscQueue, TryPushFailsWhenFull) {
+  s21::spsc_queue<int> q(4);
+  for (int i = 0; i < 4; ++i) EXPECT_TRUE(q.try_push(i));
+  EXPECT_FALSE(q.try_push(4));
+  EXPECT_EQ(q.size_approx(), 4u);
+
+  int v = -1;
+  EXPECT_TRUE(q.try_pop(v));
+  EXPECT_EQ(v, 0);
+  EXPECT_TRUE(q.try_push(4));
+  for (int i = 1; i <= 4; ++i) {
+    EXPECT_TRUE(q.try_pop(v));
+    EXPECT_EQ(v, i);
+  }
+  EXPECT_FALSE(q.try_pop(v));
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(SpscQueue, BatchPushPop) {
+  s21::spsc_queue<int> q(8);
+  int src[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  EXPECT_EQ(q.push_n(src, 10), 8u);
+  int out[10] = {};
+  EXPECT_EQ(q.pop_n(out, 3), 3u);
+  EXPECT_EQ(q.push_n(src + 8, 2), 2u);
+  EXPECT_EQ(q.pop_n(out + 3, 10), 7u);
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(out[i], i);
+}
+
+TEST(SpscQueue, DestroysRemainingElements) {
+  auto tracker = std::make_shared<int>(0);
+  {
+    s21::spsc_queue<std::shared_ptr<int>> q(4);
+    q.try_push(tracker);
+    q.try_emplace(tracker);
+    EXPECT_EQ(tracker.use_count(), 3);
+  }
+  EXPECT_EQ(tracker.use_count(), 1);
+}
+
+TEST(SpscQueue, TwoThreadsPreserveOrder) {
+  constexpr int kCount = 100000;
+  s21::spsc_queue<int> q(64);
+  std::thread producer([&] {
+    for (int i = 0; i < kCount; ++i) {
+      while (!q.try_push(i)) std::this_thread::yield();
+    }
+  });
+  int expected = 0;
+  bool in_order = true;
+  while (expected < kCount) {
+    int v = 0;
+    if (q.try_pop(v)) {
+      in_order = in_order && (v == expected);
+      ++expected;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(in_order);
+}
+
+TEST(SpscQueue, TwoThreadsBatched) {
+  constexpr int kCount = 50000;
+  s21::spsc_queue<std::string> q(32);
+  std::thread producer([&] {
+    std::string batch[5];
+    for (int i = 0; i < kCount; i += 5) {
+      for (int j = 0; j < 5; ++j) batch[j] = std::to_string(i + j);
+      std::size_t done = 0;
+      while (done < 5) {
+        done += q.push_n(batch + done, 5 - done);
+        if (done < 5) std::this_thread::yield();
+      }
+    }
+  });
+  std::string out[7];
+  int next = 0;
+  bool in_order = true;
+  while (next < kCount) {
+    const std::size_t got = q.pop_n(out, 7);
+    for (std::size_t j = 0; j < got; ++j) {
+      in_order = in_order && (out[j] == std::to_string(next++));
+    }
+    if (got == 0) std::this_thread::yield();
+  }
+  producer.join();
+  EXPECT_TRUE(in_order);
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "../s21_containersplus.h"
+
+namespace {
+
+constexpr int constexpr_roundtrip() {
+  s21::static_vector<int, 8> v{1, 2, 3};
+  v.push_back(4);
+  v.insert(v.begin(), 0);
+  v.erase(v.begin() + 2);
+  v.emplace_back(9);
+  s21::static_vector<int, 8> copy = v;
+  copy.pop_back();
+  int sum = 0;
+  for (int x : copy) sum += x;
+  return sum * 10 + static_cast<int>(v.size());
+}
+
+}  // namespace
+
+TEST(StaticVector, TraitsFollowElementType) {
+  using Trivial = s21::static_vector<int, 16>;
+  using NonTrivial = s21::static_vector<std::string, 4>;
+  static_assert(std::is_trivially_copyable_v<Trivial>);
+  static_assert(std::is_trivially_destructible_v<Trivial>);
+  static_assert(!std::is_trivially_copyable_v<NonTrivial>);
+  static_assert(sizeof(Trivial) == 16 * sizeof(int) + sizeof(std::size_t));
+  static_assert(Trivial::capacity() == 16);
+  SUCCEED();
+}
+
+TEST(StaticVector, ConstantEvaluation) {
+  static_assert(constexpr_roundtrip() == (0 + 1 + 3 + 4) * 10 + 5);
+  constexpr s21::static_vector<char, 4> table{'a', 'b'};
+  static_assert(table.size() == 2 && table.back() == 'b');
+  EXPECT_EQ(constexpr_roundtrip(), 85);
+}
+
+TEST(StaticVector, PushInsertEraseLikeVector) {
+  s21::static_vector<std::string, 6> v;
+  v.push_back("b");
+  v.emplace_back(2, 'd');
+  auto it = v.insert(v.begin(), "a");
+  EXPECT_EQ(*it, "a");
+  v.insert_many(v.begin() + 2, "c1", "c2");
+  v.insert_many_back("e");
+  ASSERT_EQ(v.size(), 6u);
+  EXPECT_TRUE(v.full());
+  const char* expected[] = {"a", "b", "c1", "c2", "dd", "e"};
+  for (std::size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], expected[i]);
+
+  v.erase(v.begin() + 1);
+  EXPECT_EQ(v.size(), 5u);
+  EXPECT_EQ(v[1], "c1");
+  EXPECT_EQ(v.back(), "e");
+  EXPECT_THROW(v.at(5), std::out_of_range);
+}
+
+TEST(StaticVector, ThrowsInsteadOfGrowing) {
+  s21::static_vector<int, 2> v{1, 2};
+  EXPECT_THROW(v.push_back(3), std::length_error);
+  EXPECT_THROW(v.insert(v.begin(), 0), std::length_error);
+  EXPECT_EQ(v.size(), 2u);
+  EXPECT_THROW((s21::static_vector<int, 2>{1, 2, 3}), std::length_error);
+  EXPECT_THROW(v.resize(3), std::length_error);
+}
+
+TEST(StaticVector, InsertAliasingElement) {
+  s21::static_vector<std::string, 4> v{"x", "y"};
+  v.insert(v.begin(), v[1]);
+  EXPECT_EQ(v[0], "y");
+  EXPECT_EQ(v[1], "x");
+  EXPECT_EQ(v[2], "y");
+}
+
+TEST(StaticVector, CopyMoveSwapManageLifetimes) {
+  auto token = std::make_shared<int>(1);
+  {
+    s21::static_vector<std::shared_ptr<int>, 8> a(3);
+    for (auto& p : a) p = token;
+    s21::static_vector<std::shared_ptr<int>, 8> b = a;
+    EXPECT_EQ(token.use_count(), 7);
+
+    s21::static_vector<std::shared_ptr<int>, 8> c{token};
+    c.swap(a);
+    EXPECT_EQ(a.size(), 1u);
+    EXPECT_EQ(c.size(), 3u);
+    EXPECT_EQ(token.use_count(), 8);
+
+    s21::static_vector<std::shared_ptr<int>, 8> d = std::move(c);
+    EXPECT_TRUE(c.empty());
+    b.resize(1);
+    EXPECT_EQ(token.use_count(), 6);
+    d.clear();
+    EXPECT_EQ(token.use_count(), 3);
+  }
+  EXPECT_EQ(token.use_count(), 1);
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+TEST(WorkStealingDeque, OwnerPopsLifoThiefStealsFifo) {
+  s21::work_stealing_deque<int> d(4);
+  for (int i = 0; i < 4; ++i) d.push(i);
+  EXPECT_EQ(d.size_approx(), 4u);
+
+  int v = -1;
+  EXPECT_TRUE(d.steal(v));
+  EXPECT_EQ(v, 0);
+  EXPECT_TRUE(d.pop(v));
+  EXPECT_EQ(v, 3);
+  EXPECT_TRUE(d.pop(v));
+  EXPECT_EQ(v, 2);
+  EXPECT_TRUE(d.steal(v));
+  EXPECT_EQ(v, 1);
+  EXPECT_FALSE(d.pop(v));
+  EXPECT_FALSE(d.steal(v));
+  EXPECT_TRUE(d.empty());
+}
+
+TEST(WorkStealingDeque, GrowsPastInitialCapacity) {
+  s21::work_stealing_deque<int> d(2);
+  int v = 0;
+  d.push(-1);
+  EXPECT_TRUE(d.steal(v));
+  for (int i = 0; i < 100; ++i) d.push(i);
+  EXPECT_GE(d.capacity(), 100u);
+  for (int i = 99; i >= 0; --i) {
+    ASSERT_TRUE(d.pop(v));
+    EXPECT_EQ(v, i);
+  }
+}
+
+TEST(WorkStealingDeque, ConcurrentStealsSeeEachItemOnce) {
+  constexpr int kItems = 20000;
+  s21::work_stealing_deque<int> d;
+  std::vector<std::atomic<int>> seen(kItems);
+  std::atomic<bool> done{false};
+
+  auto thief = [&] {
+    int v = 0;
+    while (!done.load() || !d.empty()) {
+      if (d.steal(v)) seen[v].fetch_add(1);
+    }
+  };
+  std::thread t1(thief), t2(thief);
+  int v = 0;
+  for (int i = 0; i < kItems; ++i) {
+    d.push(i);
+    if (i % 3 == 0 && d.pop(v)) seen[v].fetch_add(1);
+  }
+  while (d.pop(v)) seen[v].fetch_add(1);
+  done.store(true);
+  t1.join();
+  t2.join();
+
+  for (int i = 0; i < kItems; ++i) EXPECT_EQ(seen[i].load(), 1) << i;
+}
+
+TEST(ThreadPool, SpawnAndWait) {
+  s21::thread_pool pool(3);
+  EXPECT_EQ(pool.size(), 3u);
+  std::atomic<int> count{0};
+  for (int i = 0; i < 1000; ++i) pool.spawn([&] { count.fetch_add(1); });
+  pool.wait();
+  EXPECT_EQ(count.load(), 1000);
+}
+
+TEST(ThreadPool, ParallelForCoversRangeOnce) {
+  s21::thread_pool pool(4);
+  std::vector<int> hits(10007, 0);
+  pool.parallel_for(0, hits.size(), [&](std::size_t i) { ++hits[i]; }, 64);
+  for (int h : hits) ASSERT_EQ(h, 1);
+
+  pool.parallel_for(5, 5, [&](std::size_t) { FAIL(); });
+}
+
+long long fib(s21::thread_pool& pool, int n) {
+  if (n < 12) return n < 2 ? n : fib(pool, n - 1) + fib(pool, n - 2);
+  long long a = 0, b = 0;
+  pool.invoke([&] { a = fib(pool, n - 1); }, [&] { b = fib(pool, n - 2); });
+  return a + b;
+}
+
+TEST(ThreadPool, NestedInvoke) {
+  s21::thread_pool pool(4);
+  EXPECT_EQ(fib(pool, 22), 17711);
+}
+
+TEST(ThreadPool, TaskGroupRethrowsFirstException) {
+  s21::thread_pool pool(2);
+  s21::thread_pool::task_group group(pool);
+  std::atomic<int> ran{0};
+  for (int i = 0; i < 50; ++i) {
+    group.spawn([&, i] {
+      ran.fetch_add(1);
+      if (i == 7) throw std::runtime_error("boom");
+    });
+  }
+  EXPECT_THROW(group.wait(), std::runtime_error);
+  EXPECT_EQ(ran.load(), 50);
+  group.spawn([&] { ran.fetch_add(1); });
+  EXPECT_NO_THROW(group.wait());
+  EXPECT_EQ(ran.load(), 51);
+}
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+
+using IntTree = s21::RedBlackTree<int, const int, s21::identity_key>;
+
+struct CountingLess {
+  static inline long calls = 0;
+  bool operator()(int a, int b) const {
+    ++calls;
+    return a < b;
+  }
+};
+
+// Orders by the first member only, so equal keys stay distinguishable.
+struct FirstLess {
+  bool operator()(const std::pair<int, int>& a,
+                  const std::pair<int, int>& b) const {
+    return a.first < b.first;
+  }
+};
+
+// Throws on the copy that brings the number of live instances to limit.
+struct Fragile {
+  static inline int live = 0;
+  static inline int limit = -1;
+  int key = 0;
+
+  Fragile() { ++live; }
+  explicit Fragile(int k) : key(k) { ++live; }
+  Fragile(const Fragile& other) : key(other.key) {
+    if (live + 1 == limit) throw std::runtime_error("copy");
+    ++live;
+  }
+  ~Fragile() { --live; }
+  bool operator<(const Fragile& other) const { return key < other.key; }
+};
+
+}  // namespace
+
+TEST(TreeBulk, BalancedBuildIsValidForEverySize) {
+  for (int n = 0; n <= 300; ++n) {
+    std::vector<int> keys(static_cast<std::size_t>(n));
+    std::iota(keys.begin(), keys.end(), 0);
+    IntTree t;
+    t.assign_sorted(keys.begin(), keys.end());
+    ASSERT_TRUE(t.verify()) << "n = " << n;
+    ASSERT_EQ(t.size(), keys.size());
+    ASSERT_TRUE(std::equal(t.begin(), t.end(), keys.begin(), keys.end()));
+  }
+}
+
+TEST(TreeBulk, BuiltTreeSurvivesChurn) {
+  std::vector<int> keys(1000);
+  std::iota(keys.begin(), keys.end(), 0);
+  IntTree t;
+  t.assign_range<true>(keys.begin(), keys.end());
+  std::set<int> ref(keys.begin(), keys.end());
+  std::mt19937 rng(5);
+  for (int step = 0; step < 3000; ++step) {
+    const int key = static_cast<int>(rng() % 1500);
+    if (rng() & 1u) {
+      t.insert_unique(key);
+      ref.insert(key);
+    } else if (auto it = t.find(key); it != t.end()) {
+      t.erase(it);
+      ref.erase(key);
+    }
+  }
+  EXPECT_TRUE(t.verify());
+  EXPECT_TRUE(std::equal(t.begin(), t.end(), ref.begin(), ref.end()));
+}
+
+TEST(TreeBulk, SortedInputNeedsOnlyTheOrderCheck) {
+  std::vector<int> keys(5000);
+  std::iota(keys.begin(), keys.end(), 0);
+  CountingLess::calls = 0;
+  s21::set<int, CountingLess> checked(keys.begin(), keys.end());
+  EXPECT_EQ(CountingLess::calls, static_cast<long>(keys.size()) - 1);
+
+  CountingLess::calls = 0;
+  s21::set<int, CountingLess> trusted(s21::sorted_unique, keys.begin(),
+                                      keys.end());
+  EXPECT_EQ(CountingLess::calls, 0);
+  EXPECT_EQ(trusted.size(), keys.size());
+  EXPECT_EQ(*trusted.begin(), 0);
+  EXPECT_EQ(*std::prev(trusted.end()), 4999);
+}
+
+TEST(TreeBulk, UnsortedInputKeepsFirstDuplicate) {
+  const std::vector<std::pair<int, std::string>> items{
+      {3, "c"}, {1, "a"}, {3, "x"}, {2, "b"}, {1, "y"}};
+  s21::map<int, std::string> m(items.begin(), items.end());
+  ASSERT_EQ(m.size(), 3u);
+  EXPECT_EQ(m.at(1), "a");
+  EXPECT_EQ(m.at(3), "c");
+  EXPECT_EQ((*m.begin()).first, 1);
+
+  s21::set<int> s{5, 3, 5, 1, 3};
+  EXPECT_EQ(std::vector<int>(s.begin(), s.end()),
+            (std::vector<int>{1, 3, 5}));
+}
+
+TEST(TreeBulk, MultisetKeepsInputOrderOfEquals) {
+  const std::vector<std::pair<int, int>> items{
+      {2, 0}, {1, 0}, {2, 1}, {1, 1}, {2, 2}};
+  s21::multiset<std::pair<int, int>, FirstLess> ms(items.begin(),
+                                                   items.end());
+  const std::vector<std::pair<int, int>> expected{
+      {1, 0}, {1, 1}, {2, 0}, {2, 1}, {2, 2}};
+  const std::vector<std::pair<int, int>> got(ms.begin(), ms.end());
+  EXPECT_EQ(got, expected);
+  EXPECT_EQ(ms.count({2, -1}), 3u);
+
+  const std::vector<int> sorted{1, 1, 2, 2, 2, 7};
+  s21::multiset<int> eq(s21::sorted_equivalent, sorted.begin(),
+                        sorted.end());
+  EXPECT_EQ(std::vector<int>(eq.begin(), eq.end()), sorted);
+}
+
+TEST(TreeBulk, SinglePassAndConvertingInput) {
+  std::istringstream in("9 4 7 4 1");
+  s21::set<int> s{std::istream_iterator<int>(in),
+                  std::istream_iterator<int>()};
+  EXPECT_EQ(std::vector<int>(s.begin(), s.end()),
+            (std::vector<int>{1, 4, 7, 9}));
+
+  const std::vector<const char*> words{"pear", "apple", "fig"};
+  s21::set<std::string> ws(words.begin(), words.end());
+  EXPECT_EQ(std::vector<std::string>(ws.begin(), ws.end()),
+            (std::vector<std::string>{"apple", "fig", "pear"}));
+}
+
+TEST(TreeBulk, AssignReplacesContents) {
+  s21::map<int, int> m{{100, 1}, {200, 2}};
+  const std::vector<std::pair<const int, int>> items{{1, 10}, {2, 20}};
+  m.assign(items.begin(), items.end());
+  ASSERT_EQ(m.size(), 2u);
+  EXPECT_FALSE(m.contains(100));
+  EXPECT_EQ(m.at(2), 20);
+  m.insert(3, 30);
+  EXPECT_EQ((*std::prev(m.end())).first, 3);
+
+  m.assign(s21::sorted_unique, items.begin(), items.begin());
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.begin(), m.end());
+}
+
+TEST(TreeBulk, FailedAssignLeavesTreeUntouched) {
+  std::vector<Fragile> src;
+  for (int i = 0; i < 50; ++i) src.emplace_back(i);
+  s21::set<Fragile> s;
+  s.insert(Fragile(-1));
+  const int before = Fragile::live;
+  Fragile::limit = before + 30;
+  EXPECT_THROW(s.assign(src.begin(), src.end()), std::runtime_error);
+  Fragile::limit = -1;
+  EXPECT_EQ(Fragile::live, before);
+  ASSERT_EQ(s.size(), 1u);
+  EXPECT_EQ(s.begin()->key, -1);
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <cctype>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+
+struct CaseInsensitiveLess {
+  bool operator()(const std::string& a, const std::string& b) const {
+    const std::size_t n = a.size() < b.size() ? a.size() : b.size();
+    for (std::size_t i = 0; i < n; ++i) {
+      const int ca = std::tolower(static_cast<unsigned char>(a[i]));
+      const int cb = std::tolower(static_cast<unsigned char>(b[i]));
+      if (ca != cb) return ca < cb;
+    }
+    return a.size() < b.size();
+  }
+};
+
+// Transparent comparator that records how many lookups reached it with a
+// non-string operand, i.e. without materializing a std::string.
+struct CountingLess {
+  using is_transparent = void;
+  static inline int view_calls = 0;
+
+  bool operator()(std::string_view a, std::string_view b) const {
+    return a < b;
+  }
+  bool operator()(const std::string& a, const std::string& b) const {
+    return a < b;
+  }
+  bool operator()(const std::string& a, std::string_view b) const {
+    ++view_calls;
+    return std::string_view(a) < b;
+  }
+  bool operator()(std::string_view a, const std::string& b) const {
+    ++view_calls;
+    return a < std::string_view(b);
+  }
+};
+
+template <class M>
+concept FindsByView = requires(M& m, std::string_view k) { m.find(k); };
+
+}  // namespace
+
+TEST(TreeCompare, ReversedOrder) {
+  s21::set<int, std::greater<int>> s{3, 1, 4, 1, 5};
+  std::vector<int> got;
+  for (auto it = s.begin(); it != s.end(); ++it) got.push_back(*it);
+  EXPECT_EQ(got, (std::vector<int>{5, 4, 3, 1}));
+  EXPECT_EQ(*s.lower_bound(2), 1);
+
+  s21::multiset<int, std::greater<int>> ms{2, 2, 7};
+  EXPECT_EQ(*ms.begin(), 7);
+  EXPECT_EQ(ms.count(2), 2u);
+}
+
+TEST(TreeCompare, CaseInsensitiveMap) {
+  s21::map<std::string, int, CaseInsensitiveLess> m;
+  m["Apple"] = 1;
+  m["apple"] += 10;
+  m.insert("BANANA", 2);
+  EXPECT_EQ(m.size(), 2u);
+  EXPECT_EQ(m.at("APPLE"), 11);
+  EXPECT_TRUE(m.contains("banana"));
+  EXPECT_EQ((*m.begin()).first, "Apple");
+}
+
+TEST(TreeCompare, StatelessComparatorTakesNoSpace) {
+  static_assert(sizeof(s21::set<int, std::greater<int>>) ==
+                sizeof(s21::set<int>));
+  static_assert(sizeof(s21::map<std::string, int, CaseInsensitiveLess>) ==
+                sizeof(s21::map<std::string, int>));
+  SUCCEED();
+}
+
+TEST(TreeCompare, StatefulComparator) {
+  using Cmp = std::function<bool(int, int)>;
+  int mod = 10;
+  s21::set<int, Cmp> s(Cmp([mod](int a, int b) { return a % mod < b % mod; }));
+  s.insert(13);
+  s.insert(23);  // same residue as 13
+  s.insert(5);
+  EXPECT_EQ(s.size(), 2u);
+  s21::set<int, Cmp> copy = s;
+  EXPECT_TRUE(copy.contains(3));
+}
+
+TEST(TreeCompare, TransparentLookupAvoidsKeyConstruction) {
+  s21::map<std::string, int, CountingLess> m{{"alpha", 1}, {"beta", 2}};
+  m.insert("gamma", 3);
+  CountingLess::view_calls = 0;
+
+  const std::string_view key = "beta";
+  auto it = m.find(key);
+  ASSERT_NE(it, m.end());
+  EXPECT_EQ((*it).second, 2);
+  EXPECT_GT(CountingLess::view_calls, 0);
+  EXPECT_TRUE(m.contains(std::string_view("gamma")));
+  EXPECT_EQ(m.count(std::string_view("delta")), 0u);
+  EXPECT_EQ((*m.lower_bound(std::string_view("b"))).first, "beta");
+  EXPECT_EQ((*m.upper_bound(std::string_view("beta"))).first, "gamma");
+
+  s21::set<std::string, std::less<>> s{"x", "y"};
+  EXPECT_TRUE(s.contains("x"));
+  EXPECT_EQ(s.count(std::string_view("z")), 0u);
+
+  s21::multiset<std::string, std::less<>> ms{"k", "k", "m"};
+  EXPECT_EQ(ms.count(std::string_view("k")), 2u);
+  auto [lo, hi] = ms.equal_range("k");
+  EXPECT_EQ(std::distance(lo, hi), 2);
+}
+
+TEST(TreeCompare, HeterogeneousOverloadsNeedTransparentCompare) {
+  using Plain = s21::map<std::string, int>;
+  using Transparent = s21::map<std::string, int, std::less<>>;
+  static_assert(!FindsByView<Plain>);
+  static_assert(FindsByView<Transparent>);
+  SUCCEED();
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+
+struct CountingLess {
+  static inline long calls = 0;
+  bool operator()(int a, int b) const {
+    ++calls;
+    return a < b;
+  }
+};
+
+// Orders by the first member only, so equal keys stay distinguishable.
+struct FirstLess {
+  bool operator()(const std::pair<int, int>& a,
+                  const std::pair<int, int>& b) const {
+    return a.first < b.first;
+  }
+};
+
+}  // namespace
+
+TEST(TreeHint, SortedLoadWithEndHintIsLinear) {
+  constexpr int kN = 4096;
+  s21::map<int, int, CountingLess> hinted;
+  CountingLess::calls = 0;
+  for (int i = 0; i < kN; ++i) hinted.insert(hinted.end(), {i, i});
+  const long hinted_calls = CountingLess::calls;
+
+  s21::map<int, int, CountingLess> plain;
+  CountingLess::calls = 0;
+  for (int i = 0; i < kN; ++i) plain.insert({i, i});
+
+  EXPECT_LE(hinted_calls, 2 * kN);
+  EXPECT_GT(CountingLess::calls, 5 * hinted_calls);
+  ASSERT_EQ(hinted.size(), static_cast<std::size_t>(kN));
+  int expected = 0;
+  for (const auto& kv : hinted) EXPECT_EQ(kv.first, expected++);
+}
+
+TEST(TreeHint, HintBeforeExistingAndWrongHint) {
+  s21::set<int> s{10, 20, 30};
+  auto it = s.insert(s.find(20), 15);
+  EXPECT_EQ(*it, 15);
+  EXPECT_EQ(*std::next(it), 20);
+  // A hint on the wrong side still inserts in order.
+  s.insert(s.begin(), 100);
+  s.insert(s.end(), 1);
+  std::vector<int> got(s.begin(), s.end());
+  EXPECT_EQ(got, (std::vector<int>{1, 10, 15, 20, 30, 100}));
+}
+
+TEST(TreeHint, EmplaceHintKeepsExistingValue) {
+  s21::map<int, std::string> m{{1, "one"}, {3, "three"}};
+  auto it = m.emplace_hint(m.find(3), 2, "two");
+  EXPECT_EQ((*it).second, "two");
+  auto dup = m.emplace_hint(m.end(), 1, "uno");
+  EXPECT_EQ((*dup).second, "one");
+  EXPECT_EQ(m.size(), 3u);
+
+  s21::set<std::string> s;
+  s.emplace_hint(s.end(), 3, 'x');
+  EXPECT_TRUE(s.contains("xxx"));
+}
+
+TEST(TreeHint, MultisetInsertsNextToHint) {
+  s21::multiset<std::pair<int, int>, FirstLess> ms{{1, 0}, {2, 0}, {3, 0}};
+  auto two = ms.find({2, -1});
+  ms.insert(two, {2, 1});
+  ms.emplace_hint(ms.end(), 2, 2);
+  std::vector<std::pair<int, int>> got(ms.begin(), ms.end());
+  EXPECT_EQ(got, (std::vector<std::pair<int, int>>{
+                     {1, 0}, {2, 1}, {2, 0}, {2, 2}, {3, 0}}));
+}
+
+TEST(TreeHint, IteratesPastMaximumAtRoot) {
+  s21::set<int> one{1};
+  EXPECT_EQ(std::distance(one.begin(), one.end()), 1);
+  s21::set<int> two{2, 1};
+  EXPECT_EQ(std::distance(two.begin(), two.end()), 2);
+  s21::multiset<int> dup{5, 5};
+  EXPECT_EQ(std::distance(dup.begin(), dup.end()), 2);
+}
+
+TEST(TreeHint, ExtremesFollowEraseAndRandomHints) {
+  s21::multiset<int> ms;
+  std::multiset<int> ref;
+  std::mt19937 rng(99);
+  for (int step = 0; step < 4000; ++step) {
+    const int key = static_cast<int>(rng() % 200);
+    const unsigned op = rng() % 4;
+    if (op == 0 && !ms.empty()) {
+      // Favour the ends so min/max maintenance is exercised.
+      auto it = rng() & 1u ? ms.begin() : std::prev(ms.end());
+      ref.erase(ref.find(*it));
+      ms.erase(it);
+    } else if (op == 1) {
+      auto it = ms.find(key);
+      if (it != ms.end()) {
+        ms.erase(it);
+        ref.erase(ref.find(key));
+      }
+    } else {
+      auto hint = ms.lower_bound(static_cast<int>(rng() % 200));
+      ms.insert(hint, key);
+      ref.insert(key);
+    }
+    ASSERT_EQ(ms.size(), ref.size());
+    if (!ref.empty()) {
+      ASSERT_EQ(*ms.begin(), *ref.begin());
+      ASSERT_EQ(*std::prev(ms.end()), *ref.rbegin());
+    }
+  }
+  EXPECT_TRUE(std::equal(ms.begin(), ms.end(), ref.begin(), ref.end()));
+}
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+
+using IntTree = s21::RedBlackTree<int, const int, s21::identity_key,
+                                  std::less<int>, std::allocator<int>, true>;
+
+template <class C>
+concept HasNth = requires(C c) { c.nth(0); };
+template <class It>
+concept HasJump = requires(It it) { it += 1; };
+
+struct CountingLess {
+  static inline long calls = 0;
+  bool operator()(int a, int b) const {
+    ++calls;
+    return a < b;
+  }
+};
+
+}  // namespace
+
+TEST(TreeRank, CountsSurviveRandomChurn) {
+  IntTree t;
+  std::vector<int> ref;
+  std::mt19937 rng(21);
+  for (int step = 0; step < 5000; ++step) {
+    const int key = static_cast<int>(rng() % 300);
+    if (rng() % 3 == 0) {
+      auto it = t.find(key);
+      if (it != t.end()) {
+        t.erase(it);
+        ref.erase(std::lower_bound(ref.begin(), ref.end(), key));
+      }
+    } else {
+      t.insert_equal(key);
+      ref.insert(std::upper_bound(ref.begin(), ref.end(), key), key);
+    }
+    if (step % 500 == 0) {
+      ASSERT_TRUE(t.verify()) << "step " << step;
+    }
+  }
+  ASSERT_TRUE(t.verify());
+  for (std::size_t k = 0; k < ref.size(); k += 7) {
+    ASSERT_EQ(*t.make_iterator(t.nth_node(k)), ref[k]);
+  }
+  for (int key = -1; key <= 301; ++key) {
+    const auto lo = std::lower_bound(ref.begin(), ref.end(), key);
+    const auto hi = std::upper_bound(ref.begin(), ref.end(), key);
+    ASSERT_EQ(t.rank(key), static_cast<std::size_t>(lo - ref.begin()));
+    ASSERT_EQ(t.count(key), static_cast<std::size_t>(hi - lo));
+  }
+}
+
+TEST(TreeRank, NthRankAndRangeOnContainers) {
+  s21::ranked_set<int> s{50, 10, 40, 20, 30};
+  EXPECT_EQ(*s.nth(0), 10);
+  EXPECT_EQ(*s.nth(3), 40);
+  EXPECT_EQ(s.nth(5), s.end());
+  EXPECT_EQ(s.rank(30), 2u);
+  EXPECT_EQ(s.rank(35), 3u);
+  EXPECT_EQ(s.rank(5), 0u);
+  EXPECT_EQ(s.count_range(15, 45), 3u);
+  EXPECT_EQ(s.count_range(45, 15), 0u);
+
+  s21::ranked_map<int, char> m{{3, 'c'}, {1, 'a'}, {2, 'b'}};
+  EXPECT_EQ((*m.nth(1)).second, 'b');
+  m.erase(m.nth(0));
+  EXPECT_EQ(m.rank(3), 1u);
+  EXPECT_EQ((*m.nth(0)).first, 2);
+}
+
+TEST(TreeRank, PercentilesOfMultiset) {
+  s21::ranked_multiset<int> latencies;
+  for (int i = 1; i <= 1000; ++i) latencies.insert(i % 100);
+  const auto pct = [&](double p) {
+    return *latencies.nth(
+        static_cast<std::size_t>(p * (latencies.size() - 1)));
+  };
+  EXPECT_EQ(pct(0.0), 0);
+  EXPECT_EQ(pct(0.5), 49);
+  EXPECT_EQ(pct(0.99), 98);
+  EXPECT_EQ(latencies.count(7), 10u);
+  EXPECT_EQ(latencies.count_range(10, 20), 100u);
+}
+
+TEST(TreeRank, CountIsLogarithmicInDuplicates) {
+  s21::ranked_multiset<int, CountingLess> ms;
+  for (int i = 0; i < 20000; ++i) ms.insert(ms.end(), i < 10000 ? 5 : 9);
+  CountingLess::calls = 0;
+  EXPECT_EQ(ms.count(5), 10000u);
+  EXPECT_EQ(ms.count(9), 10000u);
+  EXPECT_EQ(ms.count(7), 0u);
+  EXPECT_LT(CountingLess::calls, 6 * 2 * 32);
+}
+
+TEST(TreeRank, IteratorJumps) {
+  std::vector<int> keys(100);
+  for (int i = 0; i < 100; ++i) keys[static_cast<std::size_t>(i)] = 2 * i;
+  const s21::ranked_set<int> s(keys.begin(), keys.end());
+  auto it = s.begin();
+  it += 10;
+  EXPECT_EQ(*it, 20);
+  EXPECT_EQ(*(it + 5), 30);
+  EXPECT_EQ(*(it - 10), 0);
+  it -= 3;
+  EXPECT_EQ(*it, 14);
+  EXPECT_EQ(s.end() - s.begin(), 100);
+  EXPECT_EQ(s.find(60) - it, 23);
+  EXPECT_EQ(it + 93, s.end());
+  EXPECT_EQ(*(s.end() - 1), 198);
+
+  s21::ranked_multiset<int> ms{4, 4, 4, 1};
+  auto mit = ms.begin() + 2;
+  EXPECT_EQ(*mit, 4);
+  EXPECT_EQ(ms.end() - mit, 2);
+}
+
+TEST(TreeRank, MaxSizeFollowsCountWidth) {
+  EXPECT_EQ(IntTree::max_size(), std::numeric_limits<std::uint32_t>::max());
+  EXPECT_LE(s21::ranked_set<char>().max_size(), IntTree::max_size());
+  EXPECT_GT(s21::set<char>().max_size(), IntTree::max_size());
+}
+
+TEST(TreeRank, PlainTreesCarryNoCounts) {
+  // The count fills the padding after a four-byte key but adds a word
+  // after an eight-byte one.
+  static_assert(sizeof(s21::Node<const int, true>) ==
+                sizeof(s21::Node<const int>));
+  static_assert(sizeof(s21::Node<std::pair<const int, int>, true>) ==
+                sizeof(s21::Node<std::pair<const int, int>>) + sizeof(void*));
+  static_assert(!HasNth<s21::set<int>>);
+  static_assert(!HasNth<s21::map<int, int>>);
+  static_assert(!HasNth<s21::multiset<int>>);
+  static_assert(HasNth<s21::ranked_multiset<int>>);
+  static_assert(!HasJump<s21::set<int>::iterator>);
+  static_assert(HasJump<s21::ranked_set<int>::iterator>);
+
+  s21::multiset<int> ms{3, 1, 3, 2, 3};
+  EXPECT_EQ(ms.count(3), 3u);
+  EXPECT_EQ(ms.count(4), 0u);
+}
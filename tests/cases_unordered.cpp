@@ -0,0 +1,280 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+
+// Four hash values for all keys: every probe runs through long chains of
+// full and deleted slots.
+struct CollidingHash {
+  std::size_t operator()(int k) const {
+    return static_cast<std::size_t>(k & 3);
+  }
+};
+
+struct StringHash {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view s) const {
+    return std::hash<std::string_view>()(s);
+  }
+};
+
+struct ThrowOnCopy {
+  int value = 0;
+  ThrowOnCopy() = default;
+  explicit ThrowOnCopy(int v) : value(v) {}
+  ThrowOnCopy(const ThrowOnCopy&) { throw std::runtime_error("copy"); }
+  ThrowOnCopy(ThrowOnCopy&&) noexcept = default;
+};
+
+// Counts its copies; copies throw once the budget runs out. Moves never
+// throw unless ThrowingMove is set.
+template <bool ThrowingMove>
+struct TrackedKey {
+  static inline int copies = 0;
+  static inline int copy_budget = 1 << 30;
+  int value = 0;
+  explicit TrackedKey(int v) : value(v) {}
+  TrackedKey(const TrackedKey& o) : value(o.value) {
+    if (copy_budget-- == 0) throw std::runtime_error("copy");
+    ++copies;
+  }
+  TrackedKey(TrackedKey&& o) noexcept(!ThrowingMove) : value(o.value) {}
+  TrackedKey& operator=(const TrackedKey&) = default;
+  bool operator==(const TrackedKey& o) const { return value == o.value; }
+};
+
+struct TrackedHash {
+  template <bool B>
+  std::size_t operator()(const TrackedKey<B>& k) const {
+    return static_cast<std::size_t>(k.value);
+  }
+};
+
+template <class Map, class Ref>
+void expect_same(const Map& m, const Ref& ref) {
+  ASSERT_EQ(m.size(), ref.size());
+  std::size_t seen = 0;
+  for (const auto& [key, value] : m) {
+    auto it = ref.find(key);
+    ASSERT_NE(it, ref.end()) << key;
+    EXPECT_EQ(value, it->second);
+    ++seen;
+  }
+  EXPECT_EQ(seen, ref.size());
+}
+
+}  // namespace
+
+TEST(Unordered, ChurnMatchesStdUnorderedMap) {
+  s21::unordered_map<int, int> m;
+  std::unordered_map<int, int> ref;
+  std::mt19937 rng(17);
+  for (int step = 0; step < 60000; ++step) {
+    const int key = static_cast<int>(rng() % 5000);
+    switch (rng() % 4) {
+      case 0:
+      case 1:
+        ASSERT_EQ(m.insert({key, step}).second,
+                  ref.insert({key, step}).second);
+        break;
+      case 2:
+        ASSERT_EQ(m.erase(key), ref.erase(key));
+        break;
+      default:
+        ASSERT_EQ(m.contains(key), ref.count(key) == 1);
+    }
+  }
+  expect_same(m, ref);
+  EXPECT_LE(m.load_factor(), m.max_load_factor());
+}
+
+TEST(Unordered, CollidingKeysSurviveTombstones) {
+  s21::unordered_map<int, int, CollidingHash> m;
+  std::unordered_map<int, int> ref;
+  std::mt19937 rng(5);
+  for (int step = 0; step < 20000; ++step) {
+    const int key = static_cast<int>(rng() % 300);
+    if (rng() & 1u) {
+      m[key] = step;
+      ref[key] = step;
+    } else {
+      ASSERT_EQ(m.erase(key), ref.erase(key));
+    }
+  }
+  expect_same(m, ref);
+  // Erasing everything through iterators visits each element once.
+  std::size_t erased = 0;
+  for (auto it = m.begin(); it != m.end(); ++erased) it = m.erase(it);
+  EXPECT_EQ(erased, ref.size());
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.begin(), m.end());
+}
+
+TEST(Unordered, ReserveKeepsIteratorsValid) {
+  s21::unordered_set<int> s;
+  s.reserve(1000);
+  const auto buckets = s.bucket_count();
+  EXPECT_GE(buckets, 1000u);
+  auto first = s.insert(-1).first;
+  for (int i = 0; i < 999; ++i) s.insert(i);
+  EXPECT_EQ(s.bucket_count(), buckets);
+  EXPECT_EQ(*first, -1);
+
+  auto res = s.insert_many(5000, 5001, 5, 5002);
+  ASSERT_EQ(res.size(), 4u);
+  EXPECT_FALSE(res[2].second);
+  for (const auto& [it, inserted] : res) EXPECT_EQ(s.find(*it), it);
+
+  for (int i = 0; i < 900; ++i) s.erase(i);
+  s.rehash(0);
+  EXPECT_LT(s.bucket_count(), buckets);
+  EXPECT_EQ(s.size(), 103u);
+  EXPECT_TRUE(s.contains(5001));
+  s.clear();
+  s.rehash(0);
+  EXPECT_EQ(s.bucket_count(), 0u);
+  EXPECT_EQ(s.begin(), s.end());
+  EXPECT_FALSE(s.contains(1));
+}
+
+TEST(Unordered, MapInterface) {
+  s21::unordered_map<std::string, int, StringHash, std::equal_to<>> m{
+      {"one", 1}, {"two", 2}, {"one", 10}};
+  EXPECT_EQ(m.size(), 2u);
+  EXPECT_EQ(m.at("one"), 1);
+  EXPECT_THROW(m.at("three"), std::out_of_range);
+  m["three"] = 3;
+  EXPECT_FALSE(m.insert("three", 30).second);
+  EXPECT_FALSE(m.insert_or_assign("three", 33).second);
+  EXPECT_EQ(m["three"], 33);
+  EXPECT_TRUE(m.emplace("four", 4).second);
+  EXPECT_FALSE(m.try_emplace("four", 40).second);
+
+  const std::string_view key = "two";
+  EXPECT_TRUE(m.contains(key));
+  EXPECT_EQ(m.find(key)->second, 2);
+  EXPECT_EQ(m.count(std::string_view("five")), 0u);
+  EXPECT_EQ(m.erase(key), 1u);
+
+  auto res = m.insert_many(std::pair<const std::string, int>{"five", 5},
+                           std::pair<const std::string, int>{"one", 100});
+  EXPECT_TRUE(res[0].second);
+  EXPECT_EQ(res[1].first->second, 1);
+  EXPECT_EQ(m.size(), 4u);
+
+  s21::unordered_map<std::string, int, StringHash, std::equal_to<>> other{
+      {"one", -1}, {"six", 6}};
+  m.merge(other);
+  EXPECT_EQ(m.at("six"), 6);
+  EXPECT_EQ(m.at("one"), 1);
+  ASSERT_EQ(other.size(), 1u);
+  EXPECT_EQ(other.begin()->first, "one");
+}
+
+TEST(Unordered, SetInterfaceAndCopies) {
+  s21::unordered_set<std::string> s{"a", "b"};
+  s21::unordered_set<std::string> t{"b", "c"};
+  s.merge(t);
+  std::vector<std::string> got(s.begin(), s.end());
+  std::sort(got.begin(), got.end());
+  EXPECT_EQ(got, (std::vector<std::string>{"a", "b", "c"}));
+  ASSERT_EQ(t.size(), 1u);
+  EXPECT_EQ(*t.begin(), "b");
+
+  for (int i = 0; i < 2000; ++i) s.emplace(std::to_string(i));
+  auto copy = s;
+  auto moved = std::move(s);
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(s.begin(), s.end());
+  s = copy;
+  copy.erase("42");
+  EXPECT_EQ(moved.size(), 2003u);
+  EXPECT_TRUE(s.contains("42"));
+  EXPECT_FALSE(copy.contains("42"));
+  EXPECT_TRUE(moved.contains("1999"));
+}
+
+TEST(Unordered, FailedInsertLeavesTableUnchanged) {
+  s21::unordered_map<int, ThrowOnCopy> m;
+  for (int i = 0; i < 14; ++i) m.try_emplace(i, i);
+  const ThrowOnCopy value(99);
+  EXPECT_THROW(m.insert(100, value), std::runtime_error);
+  EXPECT_EQ(m.size(), 14u);
+  EXPECT_FALSE(m.contains(100));
+  EXPECT_TRUE(m.try_emplace(100, 100).second);
+  EXPECT_EQ(m.at(100).value, 100);
+}
+
+TEST(Unordered, RehashMovesKeys) {
+  using Key = TrackedKey<false>;
+  s21::unordered_map<Key, std::string, TrackedHash> m;
+  s21::unordered_multiset<Key, TrackedHash> ms;
+  s21::unordered_multimap<Key, int, TrackedHash> mm;
+  for (int i = 0; i < 1000; ++i) {
+    m.try_emplace(Key(i), std::to_string(i));
+    ms.insert(Key(i));
+    mm.insert(Key(i), i);
+  }
+  const int inserted = Key::copies;
+  m.rehash(8192);
+  ms.rehash(8192);
+  mm.rehash(8192);
+  EXPECT_EQ(Key::copies, inserted);
+  EXPECT_EQ(m.at(Key(777)), "777");
+  EXPECT_EQ(ms.count(Key(777)), 1u);
+  EXPECT_EQ(mm.count(Key(777)), 1u);
+}
+
+TEST(Unordered, ThrowingRehashLeavesTableUnchanged) {
+  using Key = TrackedKey<true>;
+  s21::unordered_map<Key, int, TrackedHash> m;
+  for (int i = 0; i < 14; ++i) m.try_emplace(Key(i), i);
+  const auto buckets = m.bucket_count();
+  Key::copy_budget = 5;
+  EXPECT_THROW(m.reserve(100), std::runtime_error);
+  Key::copy_budget = 1 << 30;
+  EXPECT_EQ(m.bucket_count(), buckets);
+  ASSERT_EQ(m.size(), 14u);
+  for (int i = 0; i < 14; ++i) EXPECT_EQ(m.at(Key(i)), i);
+  m.reserve(100);
+  EXPECT_GT(m.bucket_count(), buckets);
+  for (int i = 0; i < 14; ++i) EXPECT_EQ(m.at(Key(i)), i);
+}
+
+TEST(Unordered, InsertFromOwnElementAcrossGrowth) {
+  s21::unordered_map<int, std::string> m;
+  s21::unordered_multimap<int, std::string> mm;
+  m.try_emplace(0, std::string(40, 'a'));
+  mm.insert(0, std::string(40, 'a'));
+  std::size_t grew = 0;
+  for (int i = 1; i < 200; ++i) {
+    const auto buckets = m.bucket_count();
+    // Each new value is read from the previous key's element, also when
+    // the insert grows the table.
+    if (i % 3 == 0)
+      m.try_emplace(i, m.at(i - 1));
+    else if (i % 3 == 1)
+      m.insert(i, m.at(i - 1));
+    else
+      m.insert_or_assign(i, m.at(i - 1));
+    mm.insert(i, mm.find(i - 1)->second);
+    grew += m.bucket_count() != buckets;
+  }
+  EXPECT_GE(grew, 3u);
+  for (int i = 0; i < 200; ++i) {
+    EXPECT_EQ(m.at(i), std::string(40, 'a'));
+    EXPECT_EQ(mm.find(i)->second, std::string(40, 'a'));
+  }
+}
@@ -0,0 +1,248 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+
+struct StringHash {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view s) const {
+    return std::hash<std::string_view>()(s);
+  }
+};
+
+// An int key whose copies throw once the budget runs out.
+struct FlakyKey {
+  static inline int budget = 1 << 30;
+  int value = 0;
+  explicit FlakyKey(int v) : value(v) {}
+  FlakyKey(const FlakyKey& o) : value(o.value) {
+    if (budget-- == 0) throw std::runtime_error("copy");
+  }
+  FlakyKey(FlakyKey&&) noexcept = default;
+  bool operator==(const FlakyKey& o) const { return value == o.value; }
+};
+
+struct FlakyHash {
+  std::size_t operator()(const FlakyKey& k) const {
+    return static_cast<std::size_t>(k.value);
+  }
+};
+
+template <class Map>
+std::vector<int> values_of(Map& m, int key) {
+  std::vector<int> got;
+  auto [first, last] = m.equal_range(key);
+  for (; first != last; ++first) got.push_back(first->second);
+  return got;
+}
+
+}  // namespace
+
+TEST(UnorderedMulti, SetCountsMatchStdMultiset) {
+  s21::unordered_multiset<int> s;
+  std::map<int, std::size_t> ref;
+  std::mt19937 rng(3);
+  std::size_t total = 0;
+  for (int step = 0; step < 40000; ++step) {
+    const int key = static_cast<int>(rng() % 700);
+    switch (rng() % 5) {
+      case 0:
+      case 1:
+        EXPECT_EQ(*s.insert(key), key);
+        ++ref[key];
+        ++total;
+        break;
+      case 2: {
+        auto it = s.find(key);
+        if (it == s.end()) break;
+        s.erase(it);
+        if (--ref[key] == 0) ref.erase(key);
+        --total;
+        break;
+      }
+      case 3:
+        total -= ref[key];
+        ASSERT_EQ(s.erase(key), ref[key]);
+        ref.erase(key);
+        break;
+      default:
+        ASSERT_EQ(s.count(key), ref.count(key) ? ref[key] : 0);
+    }
+  }
+  ASSERT_EQ(s.size(), total);
+  EXPECT_EQ(static_cast<std::size_t>(std::distance(s.begin(), s.end())),
+            total);
+  for (const auto& [key, n] : ref) {
+    auto [first, last] = s.equal_range(key);
+    EXPECT_EQ(static_cast<std::size_t>(std::distance(first, last)), n);
+    EXPECT_TRUE(std::all_of(first, last, [&](int k) { return k == key; }));
+  }
+}
+
+TEST(UnorderedMulti, SetEraseOneOccurrence) {
+  s21::unordered_multiset<std::string, StringHash, std::equal_to<>> s{
+      "a", "b", "a", "a"};
+  s.insert("c", 5);
+  EXPECT_EQ(s.size(), 9u);
+  EXPECT_EQ(s.count(std::string_view("c")), 5u);
+  EXPECT_GE(s.bucket_count(), 3u);
+
+  // Erasing through iterators visits each occurrence once.
+  auto [first, last] = s.equal_range("a");
+  std::size_t erased = 0;
+  for (; first != last; ++erased) first = s.erase(first);
+  EXPECT_EQ(erased, 3u);
+  EXPECT_FALSE(s.contains("a"));
+  EXPECT_EQ(s.erase(std::string_view("c")), 5u);
+  EXPECT_EQ(s.size(), 1u);
+
+  s21::unordered_multiset<std::string, StringHash, std::equal_to<>> other{
+      "b", "d", "d"};
+  s.merge(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(s.count("b"), 2u);
+  EXPECT_EQ(s.count("d"), 2u);
+  auto res = s.insert_many(std::string("d"), std::string("e"));
+  EXPECT_EQ(*res[0], "d");
+  EXPECT_EQ(s.count("d"), 3u);
+  EXPECT_EQ(s.size(), 6u);
+}
+
+TEST(UnorderedMulti, StaleIteratorStillReachesEnd) {
+  s21::unordered_multiset<int> s{7, 7, 7, 1, 2};
+  auto last_seven = std::next(s.equal_range(7).first, 2);
+  s.erase(s.find(7));
+  // last_seven's index is now past the key's count; ++ moves to the next
+  // key instead of running off.
+  std::size_t steps = 0;
+  for (auto it = last_seven; it != s.end() && steps <= s.size(); ++it)
+    ++steps;
+  EXPECT_LE(steps, s.size());
+
+  s21::unordered_multimap<int, int> m{{7, 0}, {7, 1}, {1, 2}};
+  auto last = std::next(m.find(7));
+  m.erase(m.find(7));
+  steps = 0;
+  for (auto it = last; it != m.end() && steps <= m.size(); ++it) ++steps;
+  EXPECT_LE(steps, m.size());
+}
+
+TEST(UnorderedMulti, MapKeepsValuesInInsertionOrder) {
+  s21::unordered_multimap<int, int> m;
+  // Key 0 spills past its inline values; the rest stay inline.
+  for (int i = 0; i < 100; ++i) m.insert({i % 10 == 0 ? 0 : i, i});
+  EXPECT_EQ(m.size(), 100u);
+  EXPECT_EQ(m.count(0), 10u);
+  EXPECT_EQ(m.count(7), 1u);
+  EXPECT_EQ(m.count(10), 0u);
+  const std::vector<int> zeros{0, 10, 20, 30, 40, 50, 60, 70, 80, 90};
+  EXPECT_EQ(values_of(m, 0), zeros);
+
+  auto it = m.find(0);
+  ASSERT_NE(it, m.end());
+  (*it).second = -1;
+  EXPECT_EQ(it->first, 0);
+  EXPECT_EQ(m.equal_range(0).first->second, -1);
+
+  // Erasing one value keeps the order of the rest.
+  it = m.erase(m.find(0));
+  EXPECT_EQ(it->second, 10);
+  std::size_t visited = 0;
+  for (auto [key, value] : m) {
+    EXPECT_TRUE(key == value || key == 0);
+    ++visited;
+  }
+  EXPECT_EQ(visited, 99u);
+  EXPECT_EQ(m.erase(0), 9u);
+  EXPECT_EQ(m.erase(0), 0u);
+  EXPECT_EQ(m.size(), 90u);
+}
+
+TEST(UnorderedMulti, MapMergeAndCopies) {
+  using Map =
+      s21::unordered_multimap<std::string, std::string, StringHash,
+                              std::equal_to<>>;
+  Map m{{"x", "1"}, {"y", "2"}};
+  Map other{{"x", "3"}, {"z", "4"}, {"z", "5"}};
+  m.merge(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(other.begin(), other.end());
+  EXPECT_EQ(m.size(), 5u);
+  EXPECT_EQ(m.count(std::string_view("x")), 2u);
+  auto [first, last] = m.equal_range(std::string_view("z"));
+  ASSERT_NE(first, last);
+  EXPECT_EQ(first->second, "4");
+  EXPECT_EQ((++first)->second, "5");
+
+  // Long strings, so a spilled list owns heap memory twice over.
+  const std::string big(40, 'v');
+  for (int i = 0; i < 50; ++i) m.emplace("x", big + std::to_string(i));
+  Map copy = m;
+  Map moved = std::move(m);
+  EXPECT_TRUE(m.empty());
+  m = copy;
+  EXPECT_EQ(copy.erase("x"), 52u);
+  EXPECT_EQ(m.count("x"), 52u);
+  EXPECT_EQ(moved.size(), 55u);
+  const Map& cref = moved;
+  auto [cfirst, clast] = cref.equal_range("x");
+  EXPECT_EQ(std::distance(cfirst, clast), 52);
+  Map::const_iterator converted = m.begin();
+  EXPECT_EQ(converted, m.cbegin());
+}
+
+TEST(UnorderedMulti, ThrowingMergeLosesAndDuplicatesNothing) {
+  s21::unordered_multiset<FlakyKey, FlakyHash> a;
+  s21::unordered_multiset<FlakyKey, FlakyHash> b;
+  s21::unordered_multimap<FlakyKey, int, FlakyHash> ma;
+  s21::unordered_multimap<FlakyKey, int, FlakyHash> mb;
+  for (int k = 0; k < 40; ++k) {
+    for (int i = 0; i < 3; ++i) {
+      if (k < 20) a.insert(FlakyKey(k));
+      if (k >= 10) b.insert(FlakyKey(k));
+      if (k < 20) ma.insert(FlakyKey(k), i);
+      if (k >= 10) mb.insert(FlakyKey(k), 100 + i);
+    }
+  }
+  FlakyKey::budget = 5;
+  EXPECT_THROW(a.merge(b), std::runtime_error);
+  FlakyKey::budget = 5;
+  EXPECT_THROW(ma.merge(mb), std::runtime_error);
+  FlakyKey::budget = 1 << 30;
+
+  EXPECT_EQ(a.size() + b.size(), 150u);
+  EXPECT_EQ(ma.size() + mb.size(), 150u);
+  EXPECT_FALSE(b.empty());
+  EXPECT_FALSE(mb.empty());
+  for (int k = 0; k < 40; ++k) {
+    const FlakyKey key(k);
+    const std::size_t want = k < 10 || k >= 20 ? 3 : 6;
+    EXPECT_EQ(a.count(key) + b.count(key), want) << k;
+    EXPECT_EQ(ma.count(key) + mb.count(key), want) << k;
+  }
+  std::size_t counted = 0;
+  for (auto it = a.begin(); it != a.end(); ++it) ++counted;
+  EXPECT_EQ(counted, a.size());
+  counted = 0;
+  for (auto it = mb.begin(); it != mb.end(); ++it) ++counted;
+  EXPECT_EQ(counted, mb.size());
+
+  a.merge(b);
+  ma.merge(mb);
+  EXPECT_EQ(a.size(), 150u);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(ma.size(), 150u);
+  EXPECT_TRUE(mb.empty());
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include "../s21_containers.h"
 
 TEST(VectorExtra, ReserveAndCapacityGrowth) {
@@ -99,4 +101,63 @@ TEST(VectorInsertMany, End_CapacityIncrease) {
   EXPECT_EQ(v.size(), 7u);
   EXPECT_GT(v.capacity(), old_capacity);
   EXPECT_EQ(v.back(), 7);
-}
\ No newline at end of file
+}
+TEST(VectorExtra, EmplaceBackAndMovePush) {
+  s21::vector<std::string> v;
+  v.push_back(std::string("a"));
+  auto& ref = v.emplace_back(2, 'b');
+  EXPECT_EQ(ref, "bb");
+  v.emplace_back(v[0]);
+  ASSERT_EQ(v.size(), 3u);
+  EXPECT_EQ(v[2], "a");
+}
+
+TEST(VectorExtra, SwapAndClear) {
+  s21::vector<int> a{1, 2, 3};
+  s21::vector<int> b{4};
+  a.swap(b);
+  ASSERT_EQ(a.size(), 1u);
+  EXPECT_EQ(a[0], 4);
+  ASSERT_EQ(b.size(), 3u);
+  EXPECT_EQ(b[2], 3);
+  b.clear();
+  EXPECT_TRUE(b.empty());
+  EXPECT_GE(b.capacity(), 3u);
+
+  s21::vector<std::string> words{"alpha", "beta", "gamma"};
+  words.resize(1);
+  words.push_back("delta");
+  ASSERT_EQ(words.size(), 2u);
+  EXPECT_EQ(words[1], "delta");
+  // Released slots hold empty strings again.
+  words.clear();
+  EXPECT_TRUE(words.data()[0].empty());
+  EXPECT_TRUE(words.data()[2].empty());
+}
+
+TEST(VectorExtra, TrivialRemovalOnlyMovesTheEnd) {
+  s21::vector<int> v{1, 2, 3, 4};
+  v.pop_back();
+  v.resize(2);
+  EXPECT_EQ(v.data()[2], 3);
+  EXPECT_EQ(v.data()[3], 4);
+  v.clear();
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.data()[0], 1);
+}
+
+TEST(VectorExtra, Resize) {
+  s21::vector<int> v{1, 2, 3};
+  v.resize(5, 7);
+  ASSERT_EQ(v.size(), 5u);
+  EXPECT_EQ(v[3], 7);
+  EXPECT_EQ(v[4], 7);
+  v.resize(2);
+  EXPECT_EQ(v.size(), 2u);
+  EXPECT_EQ(v.back(), 2);
+  v.resize(4);
+  EXPECT_EQ(v[2], 0);
+  EXPECT_EQ(v[3], 0);
+  v.resize(0);
+  EXPECT_TRUE(v.empty());
+}
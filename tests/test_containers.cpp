@@ -216,19 +216,19 @@ TEST(SetTest, InitializerListConstructor) {
   EXPECT_EQ(s.size(), 7u);
 
   auto it = s.begin();
-  EXPECT_EQ((*it).first, 1);
+  EXPECT_EQ(*it, 1);
   ++it;
-  EXPECT_EQ((*it).first, 2);
+  EXPECT_EQ(*it, 2);
   ++it;
-  EXPECT_EQ((*it).first, 3);
+  EXPECT_EQ(*it, 3);
   ++it;
-  EXPECT_EQ((*it).first, 4);
+  EXPECT_EQ(*it, 4);
   ++it;
-  EXPECT_EQ((*it).first, 5);
+  EXPECT_EQ(*it, 5);
   ++it;
-  EXPECT_EQ((*it).first, 6);
+  EXPECT_EQ(*it, 6);
   ++it;
-  EXPECT_EQ((*it).first, 9);
+  EXPECT_EQ(*it, 9);
 }
 
 TEST(SetTest, Insert) {
@@ -236,7 +236,7 @@ TEST(SetTest, Insert) {
   auto result = s.insert(5);
 
   EXPECT_TRUE(result.second);
-  EXPECT_EQ((*result.first).first, 5);
+  EXPECT_EQ(*result.first, 5);
 
   auto result2 = s.insert(5);
   EXPECT_FALSE(result2.second);
@@ -253,7 +253,7 @@ TEST(SetTest, Find) {
   s21::set<int> s{1, 2, 3, 4, 5};
   auto it = s.find(3);
   EXPECT_NE(it, s.end());
-  EXPECT_EQ((*it).first, 3);
+  EXPECT_EQ(*it, 3);
 
   auto it2 = s.find(6);
   EXPECT_EQ(it2, s.end());
@@ -21,13 +21,14 @@ TEST(arrayTest, InitListConstructor) {
   EXPECT_EQ(a[2], 3);
 }
 
-TEST(ArrayTest, InitListTooMany) {
-  s21::array<int, 2> a{1, 2, 3};
+TEST(ArrayTest, InitListFewerZeroFills) {
+  s21::array<int, 3> a{1, 2};
 
-  EXPECT_EQ(a.size(), 2u);
+  EXPECT_EQ(a.size(), 3u);
 
   EXPECT_EQ(a[0], 1);
   EXPECT_EQ(a[1], 2);
+  EXPECT_EQ(a[2], 0);
 }
 
 TEST(arrayTest, CopyConstructor) {
@@ -97,9 +98,9 @@ TEST(multisetTest, InitListConstructor_Basic) {
   EXPECT_EQ(ms.size(), 3u);
 
   auto it = ms.begin();
-  EXPECT_EQ((*it++).first, 10);
-  EXPECT_EQ((*it++).first, 20);
-  EXPECT_EQ((*it++).first, 30);
+  EXPECT_EQ(*it++, 10);
+  EXPECT_EQ(*it++, 20);
+  EXPECT_EQ(*it++, 30);
 }
 
 TEST(multisetTest, InitListConstructor_Duplicates) {
@@ -111,7 +112,7 @@ TEST(multisetTest, InitListConstructor_Duplicates) {
   std::vector<int> actual;
 
   for (auto it = ms.begin(); it != ms.end(); ++it) {
-    actual.push_back((*it).first);
+    actual.push_back(*it);
   }
 
   EXPECT_EQ(actual, expected);
@@ -140,7 +141,7 @@ TEST(multisetTest, CopyAssignment) {
   multiset<int> ms2{5, 5};
   ms2 = ms1;
   EXPECT_EQ(ms2.size(), 3u);
-  EXPECT_EQ((*ms2.begin()).first, 10);
+  EXPECT_EQ(*ms2.begin(), 10);
   ms1 = ms1;
   EXPECT_EQ(ms1.size(), 3u);
 }
@@ -150,7 +151,7 @@ TEST(multisetTest, MoveAssignment) {
   multiset<int> ms2{5, 5};
   ms2 = std::move(ms1);
   EXPECT_EQ(ms2.size(), 3u);
-  EXPECT_EQ((*ms2.begin()).first, 10);
+  EXPECT_EQ(*ms2.begin(), 10);
   EXPECT_TRUE(ms1.empty());
   EXPECT_EQ(ms1.size(), 0u);
 }
@@ -177,7 +178,7 @@ TEST(multisetTest, CapacityMaxSize) {
 
 TEST(multisetTest, IteratorsBeginEnd) {
   multiset<int> ms{3, 1, 2};
-  EXPECT_EQ((*ms.begin()).first, 1);
+  EXPECT_EQ(*ms.begin(), 1);
   EXPECT_NE(ms.begin(), ms.end());
 
   multiset<int> empty_ms;
@@ -190,14 +191,14 @@ TEST(multisetTest, IteratorsTraversal) {
   std::vector<int> actual;
 
   for (auto it = ms.begin(); it != ms.end(); ++it) {
-    actual.push_back((*it).first);
+    actual.push_back(*it);
   }
   EXPECT_EQ(actual, expected);
 
   actual.clear();
   for (auto it = ms.end(); it != ms.begin();) {
     --it;
-    actual.push_back((*it).first);
+    actual.push_back(*it);
   }
   std::reverse(actual.begin(), actual.end());
   EXPECT_EQ(actual, expected);
@@ -206,11 +207,11 @@ TEST(multisetTest, IteratorsTraversal) {
 TEST(multisetTest, ConstIterators) {
   const multiset<int> ms{10, 20, 10};
   auto it = ms.begin();
-  EXPECT_EQ((*it).first, 10);
+  EXPECT_EQ(*it, 10);
   ++it;
-  EXPECT_EQ((*it).first, 10);
+  EXPECT_EQ(*it, 10);
   ++it;
-  EXPECT_EQ((*it).first, 20);
+  EXPECT_EQ(*it, 20);
 }
 
 TEST(multisetTest, ModifiersClear) {
@@ -228,8 +229,8 @@ TEST(multisetTest, ModifiersInsertBasic) {
   auto it = ms.insert(30);
 
   EXPECT_EQ(ms.size(), 3u);
-  EXPECT_EQ((*it).first, 30);
-  EXPECT_EQ((*ms.begin()).first, 10);
+  EXPECT_EQ(*it, 30);
+  EXPECT_EQ(*ms.begin(), 10);
 }
 
 TEST(multisetTest, ModifiersInsertDuplicates) {
@@ -240,14 +241,14 @@ TEST(multisetTest, ModifiersInsertDuplicates) {
   auto it3 = ms.insert(10);
 
   EXPECT_EQ(ms.size(), 4u);
-  EXPECT_EQ((*it1).first, 20);
-  EXPECT_EQ((*it2).first, 10);
-  EXPECT_EQ((*it3).first, 10);
+  EXPECT_EQ(*it1, 20);
+  EXPECT_EQ(*it2, 10);
+  EXPECT_EQ(*it3, 10);
 
   std::vector<int> expected = {10, 10, 10, 20};
   std::vector<int> actual;
   for (auto it = ms.begin(); it != ms.end(); ++it) {
-    actual.push_back((*it).first);
+    actual.push_back(*it);
   }
   EXPECT_EQ(actual, expected);
 }
@@ -258,8 +259,8 @@ TEST(multisetTest, ModifiersEraseSingle) {
   ms.erase(it);
 
   EXPECT_EQ(ms.size(), 2u);
-  EXPECT_EQ((*ms.begin()).first, 10);
-  EXPECT_EQ((*std::next(ms.begin())).first, 30);
+  EXPECT_EQ(*ms.begin(), 10);
+  EXPECT_EQ(*std::next(ms.begin()), 30);
   EXPECT_TRUE(ms.find(20) == ms.end());
 }
 
@@ -271,19 +272,19 @@ TEST(multisetTest, ModifiersEraseDuplicates) {
   ms.erase(it_first_10);
 
   EXPECT_EQ(ms.size(), 4u);
-  EXPECT_EQ((*ms.begin()).first, 10);
+  EXPECT_EQ(*ms.begin(), 10);
 
   auto it_next_10 = ms.find(10);
-  if (it_next_10 != ms.end() && (*it_next_10).first == 10) {
+  if (it_next_10 != ms.end() && *it_next_10 == 10) {
     ms.erase(it_next_10);
   }
 
   EXPECT_EQ(ms.size(), 3u);
-  EXPECT_EQ((*ms.begin()).first, 10);
+  EXPECT_EQ(*ms.begin(), 10);
 
   ms.erase(ms.find(10));
   EXPECT_EQ(ms.size(), 2u);
-  EXPECT_EQ((*ms.begin()).first, 20);
+  EXPECT_EQ(*ms.begin(), 20);
 
   ms.erase(ms.end());
   EXPECT_EQ(ms.size(), 2u);
@@ -296,9 +297,9 @@ TEST(multisetTest, ModifiersSwap) {
   ms1.swap(ms2);
 
   EXPECT_EQ(ms1.size(), 5u);
-  EXPECT_EQ((*ms1.begin()).first, 10);
+  EXPECT_EQ(*ms1.begin(), 10);
   EXPECT_EQ(ms2.size(), 4u);
-  EXPECT_EQ((*ms2.begin()).first, 1);
+  EXPECT_EQ(*ms2.begin(), 1);
 }
 
 TEST(multisetTest, ModifiersMerge) {
@@ -313,7 +314,7 @@ TEST(multisetTest, ModifiersMerge) {
   std::vector<int> expected = {5, 5, 10, 10, 20, 30, 30};
   std::vector<int> actual;
   for (auto it = ms1.begin(); it != ms1.end(); ++it) {
-    actual.push_back((*it).first);
+    actual.push_back(*it);
   }
 
   EXPECT_EQ(actual, expected);
@@ -333,10 +334,10 @@ TEST(multisetTest, ModifiersInsertMany) {
 
   EXPECT_EQ(ms.size(), 5u);
 
-  EXPECT_EQ((*results[1]).first, 20);
-  EXPECT_EQ((*results[0]).first, 5);
-  EXPECT_EQ((*results[2]).first, 10);
-  EXPECT_EQ((*results[3]).first, 5);
+  EXPECT_EQ(*results[1], 20);
+  EXPECT_EQ(*results[0], 5);
+  EXPECT_EQ(*results[2], 10);
+  EXPECT_EQ(*results[3], 5);
 
   multiset<std::string> ms_str;
   auto str_results = ms_str.insert_many("c", std::move(s2), "a", "c");
@@ -346,7 +347,7 @@ TEST(multisetTest, ModifiersInsertMany) {
   std::vector<std::string> str_expected = {"a", "b", "c", "c"};
   std::vector<std::string> str_actual;
   for (auto it = ms_str.begin(); it != ms_str.end(); ++it) {
-    str_actual.push_back((*it).first);
+    str_actual.push_back(*it);
   }
   EXPECT_EQ(str_actual, str_expected);
 }
@@ -368,11 +369,11 @@ TEST(multisetTest, LookupFind) {
 
   auto it_found = ms.find(2);
   EXPECT_NE(it_found, ms.end());
-  EXPECT_EQ((*it_found).first, 2);
+  EXPECT_EQ(*it_found, 2);
 
   auto it_first_3 = ms.find(3);
   EXPECT_NE(it_first_3, ms.end());
-  EXPECT_EQ((*it_first_3).first, 3);
+  EXPECT_EQ(*it_first_3, 3);
 
   auto it_lb_3 = ms.lower_bound(3);
   EXPECT_EQ(it_first_3, it_lb_3);
@@ -390,25 +391,25 @@ TEST(multisetTest, LookupLowerBound) {
   multiset<int> ms{10, 20, 30, 20, 20};
 
   auto it20 = ms.lower_bound(20);
-  EXPECT_EQ((*it20).first, 20);
+  EXPECT_EQ(*it20, 20);
 
   auto it15 = ms.lower_bound(15);
-  EXPECT_EQ((*it15).first, 20);
+  EXPECT_EQ(*it15, 20);
 
   auto it40 = ms.lower_bound(40);
   EXPECT_EQ(it40, ms.end());
 
-  EXPECT_EQ((*ms.lower_bound(10)).first, 10);
+  EXPECT_EQ(*ms.lower_bound(10), 10);
 }
 
 TEST(multisetTest, LookupUpperBound) {
   multiset<int> ms{10, 20, 30, 20, 20};
 
   auto it20 = ms.upper_bound(20);
-  EXPECT_EQ((*it20).first, 30);
+  EXPECT_EQ(*it20, 30);
 
   auto it15 = ms.upper_bound(15);
-  EXPECT_EQ((*it15).first, 20);
+  EXPECT_EQ(*it15, 20);
 
   auto it40 = ms.upper_bound(40);
   EXPECT_EQ(it40, ms.end());
@@ -418,18 +419,18 @@ TEST(multisetTest, LookupEqualRange) {
   multiset<int> ms{10, 20, 30, 20, 20};
 
   auto range20 = ms.equal_range(20);
-  EXPECT_EQ((*range20.first).first, 20);
-  EXPECT_EQ((*range20.second).first, 30);
+  EXPECT_EQ(*range20.first, 20);
+  EXPECT_EQ(*range20.second, 30);
   EXPECT_EQ(std::distance(range20.first, range20.second), 3);
 
   auto range30 = ms.equal_range(30);
-  EXPECT_EQ((*range30.first).first, 30);
+  EXPECT_EQ(*range30.first, 30);
   EXPECT_EQ(range30.second, ms.end());
   EXPECT_EQ(std::distance(range30.first, range30.second), 1);
 
   auto range15 = ms.equal_range(15);
-  EXPECT_EQ((*range15.first).first, 20);
-  EXPECT_EQ((*range15.second).first, 20);
+  EXPECT_EQ(*range15.first, 20);
+  EXPECT_EQ(*range15.second, 20);
   EXPECT_EQ(range15.first, range15.second);
   EXPECT_EQ(std::distance(range15.first, range15.second), 0);
 }
\ No newline at end of file